@@ -0,0 +1,12 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+
+
+class Import:
+    """
+    Benchmark the startup time of a process importing scipp
+    """
+
+    def timeraw_import_scipp(self):
+        # asv runs the returned code in a fresh interpreter.
+        return 'import scipp'
@@ -5,6 +5,7 @@
 #include <benchmark/benchmark.h>
 
 #include "scipp/variable/accumulate.h"
+#include "scipp/variable/reduction.h"
 #include "scipp/variable/variable.h"
 
 using namespace scipp;
@@ -53,4 +54,31 @@ BENCHMARK(BM_accumulate_in_place)
     ->RangeMultiplier(2)
     ->Ranges({{2, 2ul << 25ul}, {false, true}, {false, true}});
 
+// Sum along the inner dimension, using the contiguous reduction kernel of
+// add_equals. With variances this should be close to twice the time without.
+static void BM_sum_inner(benchmark::State &state) {
+  const scipp::index n = 1 << 24;
+  const auto ny = state.range(0);
+  const auto nx = n / ny;
+  const bool use_variances = state.range(1);
+  const auto var = makeBenchmarkVariable(
+      Dimensions{{Dim::X, nx}, {Dim::Y, ny}}, use_variances);
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(sum(var, Dim::Y));
+  }
+
+  const scipp::index variance_factor = use_variances ? 2 : 1;
+  state.SetItemsProcessed(state.iterations() * nx * ny);
+  state.SetBytesProcessed(state.iterations() * nx * ny * variance_factor *
+                          sizeof(double));
+  state.counters["n_outer"] = nx;
+  state.counters["n_inner"] = ny;
+  state.counters["variances"] = use_variances;
+}
+
+BENCHMARK(BM_sum_inner)
+    ->RangeMultiplier(16)
+    ->Ranges({{16, 1 << 24}, {false, true}});
+
 BENCHMARK_MAIN();
@@ -3,6 +3,7 @@
 /// @file
 #include <benchmark/benchmark.h>
 
+#include "scipp/core/large_allocation.h"
 #include "scipp/dataset/bin.h"
 #include "scipp/variable/cumulative.h"
 #include "scipp/variable/operations.h"
@@ -42,7 +43,34 @@ static void BM_bin_table(benchmark::State &state) {
 }
 BENCHMARK(BM_bin_table)
     ->RangeMultiplier(10)
-    ->Ranges({{10, 2ul << 19ul}, {2ul << 16ul, 2ul << 15ul}});
+    ->Ranges({{10, 2ul << 19ul}, {2ul << 15ul, 2ul << 16ul}});
+
+// Arguments are:
+// range(0) -> number of events
+// range(1) -> huge pages for large buffers false/true
+static void BM_bin_table_huge_pages(benchmark::State &state) {
+  const scipp::index nEvent = state.range(0);
+  const bool huge_pages = state.range(1);
+  auto &config = core::large_allocation_config();
+  const auto old_config = config;
+  config.huge_page_threshold = huge_pages ? old_config.huge_page_threshold : -1;
+  auto table = make_table(nEvent);
+  auto edges_x = make_edges(Dim::X, 1000);
+  auto edges_y = make_edges(Dim::Y, 1000);
+
+  for (auto _ : state) {
+    auto a = dataset::bin(table, {edges_x, edges_y});
+  }
+  config = old_config;
+  state.SetItemsProcessed(state.iterations() * nEvent);
+  state.counters["events"] = nEvent;
+  state.counters["huge_pages"] = huge_pages;
+}
+BENCHMARK(BM_bin_table_huge_pages)
+    ->RangeMultiplier(10)
+    ->Ranges({{static_cast<int64_t>(1e6), static_cast<int64_t>(1e8)},
+              {false, true}})
+    ->Unit(benchmark::kMillisecond);
 
 static void BM_rebin_outer(benchmark::State &state) {
   const scipp::index nx = state.range(0);
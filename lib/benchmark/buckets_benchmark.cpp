@@ -8,7 +8,9 @@
 #include "scipp/dataset/dataset.h"
 #include "scipp/dataset/shape.h"
 #include "scipp/variable/bins.h"
+#include "scipp/variable/cumulative.h"
 #include "scipp/variable/operations.h"
+#include "scipp/variable/shape.h"
 
 #include "../test/random.h"
 
@@ -51,6 +53,31 @@ BENCHMARK(BM_buckets_concatenate)
     ->RangeMultiplier(4)
     ->Ranges({{64, 2ul << 19ul}, {2ul << 20ul, 2ul << 29ul}});
 
+// Select a time window from bins sorted by event time.
+static void BM_buckets_slice_sorted(benchmark::State &state) {
+  const scipp::index nBucket = state.range(0);
+  const scipp::index nEvent = state.range(1);
+  auto events = make_buckets(nBucket, nEvent);
+  events.bin_buffer<DataArray>().coords().set(
+      Dim::X, cumsum(broadcast(1.0 * units::one, {Dim::X, nEvent}), Dim::X,
+                     CumSumMode::Exclusive));
+  const auto begin = (0.25 * nEvent) * units::one;
+  const auto end = (0.75 * nEvent) * units::one;
+  // The first call checks (and caches) that the bins are sorted.
+  benchmark::DoNotOptimize(
+      dataset::buckets::slice_sorted(events, Dim::X, begin, end));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        dataset::buckets::slice_sorted(events, Dim::X, begin, end));
+  }
+  state.SetItemsProcessed(state.iterations() * nBucket);
+  state.counters["events"] = nEvent;
+  state.counters["buckets"] = nBucket;
+}
+BENCHMARK(BM_buckets_slice_sorted)
+    ->RangeMultiplier(16)
+    ->Ranges({{64, 2ul << 15ul}, {2ul << 20ul, 2ul << 24ul}});
+
 auto make_table(const scipp::index size) {
   Dimensions dims(Dim::Event, size);
   Variable data = makeVariable<double>(Dims{Dim::Event}, Shape{size});
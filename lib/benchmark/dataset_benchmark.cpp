@@ -250,4 +250,50 @@ static void BM_Dataset_setData_replace(benchmark::State &state) {
 }
 BENCHMARK(BM_Dataset_setData_replace);
 
+// Datasets with many small items, e.g., one per detector bank.
+static Dataset make_many_items_dataset(const scipp::index itemCount,
+                                       const bool with_coords = false) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{1});
+  Dataset d;
+  for (scipp::index i = 0; i < itemCount; ++i) {
+    d.setData("bank" + std::to_string(i), var);
+    if (with_coords)
+      d.setCoord(Dim("coord" + std::to_string(i)), var);
+  }
+  return d;
+}
+
+static void BM_Dataset_many_items_setData(benchmark::State &state) {
+  const auto itemCount = state.range(0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(make_many_items_dataset(itemCount, true));
+  }
+  state.SetItemsProcessed(state.iterations() * itemCount);
+}
+BENCHMARK(BM_Dataset_many_items_setData)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_Dataset_many_items_item_access(benchmark::State &state) {
+  const auto itemCount = state.range(0);
+  const auto d = make_many_items_dataset(itemCount);
+  const auto name = "bank" + std::to_string(itemCount - 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(d[name]);
+  }
+}
+BENCHMARK(BM_Dataset_many_items_item_access)->Arg(10)->Arg(100)->Arg(1000);
+
+static void BM_Dataset_many_items_coord_access(benchmark::State &state) {
+  const auto itemCount = state.range(0);
+  const auto d = make_many_items_dataset(itemCount, true);
+  const Dim dim("coord" + std::to_string(itemCount - 1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(d.coords()[dim]);
+  }
+}
+BENCHMARK(BM_Dataset_many_items_coord_access)->Arg(10)->Arg(100)->Arg(1000);
+
 BENCHMARK_MAIN();
@@ -3,10 +3,14 @@
 /// @file
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
 #include <numeric>
+#include <random>
 
+#include "scipp/core/eigen.h"
 #include "scipp/dataset/dataset.h"
 #include "scipp/dataset/mean.h"
+#include "scipp/dataset/sort.h"
 #include "scipp/dataset/sum.h"
 
 using namespace scipp;
@@ -197,4 +201,30 @@ BENCHMARK_TEMPLATE(BM_Dataset_mean, Generate_3D_data)
     ->Ranges({/* Item count */ {16, 128},
               /* Masks count */ {1, 8}});
 
+// Sort a table with a data column, a position column, and a mask by a
+// shuffled time coord.
+static void BM_DataArray_sort(benchmark::State &state) {
+  const scipp::index size = state.range(0);
+  std::vector<int64_t> time(size);
+  std::iota(time.begin(), time.end(), int64_t{0});
+  std::shuffle(time.begin(), time.end(), std::mt19937(1234));
+  const DataArray da(
+      makeVariable<double>(Dims{Dim::Event}, Shape{size}, Values{},
+                           Variances{}),
+      {{Dim::Time,
+        makeVariable<int64_t>(Dims{Dim::Event}, Shape{size}, Values(time))},
+       {Dim::Position,
+        makeVariable<Eigen::Vector3d>(Dims{Dim::Event}, Shape{size})}},
+      {{"mask", makeVariable<bool>(Dims{Dim::Event}, Shape{size})}});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(dataset::sort(da, Dim::Time));
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+  state.SetBytesProcessed(state.iterations() * size *
+                          (2 * sizeof(double) + sizeof(int64_t) +
+                           sizeof(Eigen::Vector3d) + sizeof(bool)));
+  state.counters["size"] = size;
+}
+BENCHMARK(BM_DataArray_sort)->RangeMultiplier(10)->Range(1000, 10000000);
+
 BENCHMARK_MAIN();
@@ -11,10 +11,12 @@
 #include "scipp/dataset/dataset.h"
 #include "scipp/dataset/histogram.h"
 #include "scipp/variable/operations.h"
+#include "scipp/variable/to_unit.h"
 
 using namespace scipp;
 
-auto make_2d_events(const scipp::index size, const scipp::index count) {
+auto make_2d_events(const scipp::index size, const scipp::index count,
+                    const units::Unit &unit = units::one) {
   Variable indices = makeVariable<std::pair<scipp::index, scipp::index>>(
       Dims{Dim::X}, Shape{size});
   scipp::index row = 0;
@@ -25,7 +27,7 @@ auto make_2d_events(const scipp::index size, const scipp::index count) {
   auto weights =
       makeVariable<double>(Dims{Dim::Event}, Shape{row}, Values{}, Variances{});
   Random rand(0.0, 1000.0);
-  auto y = makeVariable<double>(Dims{Dim::Event}, Shape{row},
+  auto y = makeVariable<double>(Dims{Dim::Event}, Shape{row}, unit,
                                 Values(rand(size * count)));
   DataArray buf(weights, {{Dim::Y, y}});
   return DataArray(make_bins(indices, Dim::Event, buf));
@@ -61,4 +63,35 @@ BENCHMARK(BM_histogram)
     ->RangeMultiplier(2)
     ->Ranges({{64, 2 << 14}, {128, 2 << 11}, {false, true}});
 
+static void BM_histogram_to_unit(benchmark::State &state) {
+  const scipp::index nEvent = state.range(0);
+  const scipp::index nHist = 1e7 / nEvent;
+  const bool fused = state.range(1);
+  const auto events = make_2d_events(nHist, nEvent, units::m);
+  const auto &[indices, dim, buffer] = events.data().constituents<DataArray>();
+  auto edges = makeVariable<double>(Dims{Dim::Y}, Shape{2}, units::mm,
+                                    Values{0.0, 1e6});
+  for (auto _ : state) {
+    if (fused) {
+      benchmark::DoNotOptimize(histogram(events, edges));
+    } else {
+      // Reference: convert the event coord first, as `hist(x.to(...))` would.
+      auto converted = buffer;
+      converted.coords().set(Dim::Y,
+                             to_unit(buffer.coords()[Dim::Y], units::mm));
+      benchmark::DoNotOptimize(histogram(
+          DataArray(make_bins_no_validate(indices, dim, converted)), edges));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * nHist * nEvent);
+  state.counters["fused"] = fused;
+}
+
+// Params are:
+// - nEvent
+// - unit conversion fused into histogram kernel
+BENCHMARK(BM_histogram_to_unit)
+    ->RangeMultiplier(4)
+    ->Ranges({{64, 2 << 14}, {false, true}});
+
 BENCHMARK_MAIN();
@@ -4,6 +4,9 @@
 #include <benchmark/benchmark.h>
 
 #include "scipp/dataset/dataset.h"
+#include "scipp/dataset/slice.h"
+#include "scipp/variable/cumulative.h"
+#include "scipp/variable/shape.h"
 
 using namespace scipp;
 
@@ -69,4 +72,26 @@ BENCHMARK(BM_dataset_slice_item);
 BENCHMARK(BM_dataset_slice_item_dims);
 BENCHMARK(BM_dataset_slice_aggregate);
 
+// Label-based slicing of a time-series by a time range.
+static void BM_dataarray_slice_by_value(benchmark::State &state) {
+  const scipp::index size = state.range(0);
+  const auto time = variable::cumsum(
+      variable::broadcast(1.0 * units::s, Dimensions(Dim::Time, size)),
+      Dim::Time);
+  const DataArray da(makeVariable<double>(Dims{Dim::Time}, Shape{size}),
+                     {{Dim::Time, time}});
+  const auto begin = (0.25 * size) * units::s;
+  const auto end = (0.75 * size) * units::s;
+  // The first slice checks (and caches) that the coord is sorted.
+  benchmark::DoNotOptimize(dataset::slice(da, Dim::Time, begin, end));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(dataset::slice(da, Dim::Time, begin, end));
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["size"] = size;
+}
+BENCHMARK(BM_dataarray_slice_by_value)
+    ->RangeMultiplier(100)
+    ->Range(100, 10000000);
+
 BENCHMARK_MAIN();
@@ -280,4 +280,39 @@ static void BM_transform_buckets_inplace_unary(benchmark::State &state) {
 
 BENCHMARK(BM_transform_buckets_inplace_unary);
 
+// Memory bandwidth of transform on buffers much larger than the caches.
+// Run with, e.g., `numactl --cpunodebind=0 --membind=1` to obtain the
+// cross-socket bandwidth, and without numactl for the bandwidth with
+// first-touch placement of the output.
+// Arguments are:
+// range(0) -> number of elements in millions
+// range(1) -> in-place false/true
+static void BM_transform_bandwidth(benchmark::State &state) {
+  const auto n = state.range(0) * 1000 * 1000;
+  const bool in_place = state.range(1);
+  auto a = makeVariable<double>(Dims{Dim::X}, Shape{n});
+  const auto b = makeVariable<double>(Dims{Dim::X}, Shape{n});
+  for (auto _ : state) {
+    if (in_place) {
+      transform_in_place<Types>(
+          a, b, [](auto &a_, const auto &b_) { a_ += b_; }, "");
+    } else {
+      auto out = transform<Types>(
+          a, b, [](const auto &a_, const auto &b_) { return a_ + b_; }, "");
+      state.PauseTiming();
+      out = Variable();
+      state.ResumeTiming();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+  state.SetBytesProcessed(state.iterations() * n * 3 * sizeof(double));
+  state.counters["n"] = n;
+}
+
+BENCHMARK(BM_transform_bandwidth)
+    ->RangeMultiplier(4)
+    ->Ranges({{16, 64}, {false, true}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "scipp/units/unit.h"
+
+using namespace scipp;
+
+static void BM_Unit_from_string(benchmark::State &state) {
+  const std::string str = "m/s";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(units::Unit(str));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Unit_from_string);
+
+static void BM_Unit_name(benchmark::State &state) {
+  const auto unit = units::us;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(unit.name());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Unit_name);
+
+// Units are parsed and formatted by many threads at the same time.
+static void BM_Unit_from_string_threaded(benchmark::State &state) {
+  const std::string str = "counts/us";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(units::Unit(str).name());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Unit_from_string_threaded)->ThreadRange(1, 8);
+
+BENCHMARK_MAIN();
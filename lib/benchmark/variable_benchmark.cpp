@@ -2,11 +2,17 @@
 // Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <algorithm>
+
 #include <benchmark/benchmark.h>
 
 #include "variable_common.h"
 
+#include "scipp/core/eigen.h"
+#include "scipp/core/spatial_transforms.h"
+#include "scipp/variable/math.h"
 #include "scipp/variable/operations.h"
+#include "scipp/variable/trigonometry.h"
 #include "scipp/variable/variable.h"
 
 using namespace scipp;
@@ -215,4 +221,132 @@ static void BM_Variable_sin_deg(benchmark::State &state) {
 }
 BENCHMARK(BM_Variable_sin_deg);
 
+// Transcendental functions with vectorized kernels for contiguous arrays,
+// compared to the scalar std:: functions called element by element.
+template <class Vectorized, class Scalar>
+void run_transcendental(benchmark::State &state, Vectorized vectorized,
+                        Scalar scalar, const units::Unit &unit) {
+  const auto size = state.range(0);
+  const bool use_vectorized = state.range(1);
+  std::vector<double> values(size);
+  for (scipp::index i = 0; i < size; ++i)
+    values[i] = 0.1 + 10.0 * static_cast<double>(i) / size;
+  const auto a =
+      makeVariable<double>(Dims{Dim::X}, Shape{size}, unit, Values(values));
+  std::vector<double> out(size);
+  for (auto _ : state) {
+    if (use_vectorized) {
+      benchmark::DoNotOptimize(vectorized(a));
+    } else {
+      std::transform(values.begin(), values.end(), out.begin(), scalar);
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+  state.counters["vectorized"] = use_vectorized;
+}
+
+static void BM_Variable_exp(benchmark::State &state) {
+  run_transcendental(
+      state, [](const auto &x) { return exp(x); },
+      [](const double x) { return std::exp(x); }, units::one);
+}
+static void BM_Variable_log(benchmark::State &state) {
+  run_transcendental(
+      state, [](const auto &x) { return log(x); },
+      [](const double x) { return std::log(x); }, units::one);
+}
+static void BM_Variable_sin(benchmark::State &state) {
+  run_transcendental(
+      state, [](const auto &x) { return sin(x); },
+      [](const double x) { return std::sin(x); }, units::rad);
+}
+static void BM_Variable_cos(benchmark::State &state) {
+  run_transcendental(
+      state, [](const auto &x) { return cos(x); },
+      [](const double x) { return std::cos(x); }, units::rad);
+}
+// {false, true} -> vectorized
+BENCHMARK(BM_Variable_exp)->Ranges({{1 << 10, 1 << 22}, {false, true}});
+BENCHMARK(BM_Variable_log)->Ranges({{1 << 10, 1 << 22}, {false, true}});
+BENCHMARK(BM_Variable_sin)->Ranges({{1 << 10, 1 << 22}, {false, true}});
+BENCHMARK(BM_Variable_cos)->Ranges({{1 << 10, 1 << 22}, {false, true}});
+
+// Fixed overhead of operations on small inputs. The argument is the number of
+// elements, with 0 denoting a 0-D variable.
+static auto make_small(const scipp::index size, const units::Unit &unit) {
+  return size == 0
+             ? makeVariable<double>(unit, Values{1.0})
+             : makeVariable<double>(Dims{Dim::X}, Shape{size}, unit);
+}
+
+static void BM_Variable_small_binary_op(benchmark::State &state) {
+  const auto a = make_small(state.range(0), units::m);
+  const auto b = make_small(state.range(0), units::s);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a * b);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Variable_small_binary_op)
+    ->Unit(benchmark::kNanosecond)
+    ->Arg(0)
+    ->Arg(10);
+
+static void BM_Variable_small_in_place_op(benchmark::State &state) {
+  auto a = make_small(state.range(0), units::m);
+  const auto b = make_small(state.range(0), units::m);
+  for (auto _ : state) {
+    a += b;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Variable_small_in_place_op)
+    ->Unit(benchmark::kNanosecond)
+    ->Arg(0)
+    ->Arg(10);
+
+static void BM_Variable_small_unary_op(benchmark::State &state) {
+  const auto a = make_small(state.range(0), units::rad);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sin(a));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Variable_small_unary_op)
+    ->Unit(benchmark::kNanosecond)
+    ->Arg(0)
+    ->Arg(10);
+
+static void BM_Variable_apply_rotation(benchmark::State &state) {
+  const auto size = state.range(0);
+  Eigen::Quaterniond rotation;
+  rotation = Eigen::AngleAxisd(0.5, Eigen::Vector3d::UnitZ());
+  const auto transform = makeVariable<core::Quaternion>(
+      Values{core::Quaternion(rotation)});
+  // A chain of transforms is combined first so vectors are processed once.
+  const auto chain =
+      transform *
+      makeVariable<core::Translation>(
+          units::m, Values{core::Translation(Eigen::Vector3d(1, 2, 3))}) *
+      transform;
+  const auto vectors =
+      makeVariable<Eigen::Vector3d>(Dims{Dim::Event}, Shape{size}, units::m);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(chain * vectors);
+  }
+
+  constexpr auto read_write_factor = 2;
+  state.SetItemsProcessed(state.iterations() * size);
+  state.SetBytesProcessed(state.iterations() * sizeof(Eigen::Vector3d) * size *
+                          read_write_factor);
+}
+BENCHMARK(BM_Variable_apply_rotation)
+    ->Unit(benchmark::kMillisecond)
+    ->Arg(1e4)
+    ->Arg(1e6)
+    ->Arg(1e7);
+
 BENCHMARK_MAIN();
@@ -8,11 +8,18 @@
 /// order of insertion. In addition, its iterators throw an exception
 /// if the dict has changed size during iteration. This matches Python's
 /// behavior and avoids segfaults when misusing the dict.
+///
+/// Small dicts look up keys with a linear search. Beyond a threshold size a
+/// hash table mapping keys to their position is maintained in addition, so
+/// lookup in dicts with many items, e.g., datasets with one item per detector
+/// bank, does not scale with the number of items.
 #pragma once
 
+#include <algorithm>
 #include <functional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "scipp/common/index.h"
@@ -252,6 +259,8 @@ public:
   void reserve(const index new_capacity) {
     m_keys.reserve(new_capacity);
     m_values.reserve(new_capacity);
+    if (new_capacity > hash_threshold)
+      m_index.reserve(new_capacity);
   }
 
   [[nodiscard]] bool contains(const Key &key) const noexcept {
@@ -262,6 +271,7 @@ public:
     if (const auto key_it = find_key(key); key_it == m_keys.end()) {
       m_keys.push_back(key);
       m_values.emplace_back(std::forward<V>(value));
+      index_last_key();
     } else {
       m_values[index_of(key_it)] = std::forward<V>(value);
     }
@@ -275,12 +285,15 @@ public:
     m_keys.erase(key_it);
     mapped_type value = std::move(*value_it);
     m_values.erase(value_it);
+    // Positions of all following keys have changed.
+    rebuild_index();
     return value;
   }
 
   void clear() {
     m_keys.clear();
     m_values.clear();
+    m_index.clear();
   }
 
   [[nodiscard]] const mapped_type &operator[](const key_type &key) const {
@@ -356,11 +369,35 @@ public:
   }
 
 private:
+  /// Above this number of elements, keys are looked up using m_index.
+  static constexpr index hash_threshold = 16;
+
   Keys m_keys;
   Values m_values;
+  /// Position of each key in m_keys. Empty unless size() > hash_threshold.
+  std::unordered_map<Key, index> m_index;
 
   auto find_key(const Key &key) const noexcept {
-    return std::find(m_keys.begin(), m_keys.end(), key);
+    if (m_index.empty())
+      return std::find(m_keys.begin(), m_keys.end(), key);
+    const auto it = m_index.find(key);
+    return it == m_index.end() ? m_keys.end()
+                               : std::next(m_keys.begin(), it->second);
+  }
+
+  void index_last_key() {
+    if (!m_index.empty())
+      m_index.emplace(m_keys.back(), size() - 1);
+    else if (size() > hash_threshold)
+      rebuild_index();
+  }
+
+  void rebuild_index() {
+    m_index.clear();
+    if (size() <= hash_threshold)
+      return;
+    for (index i = 0; i < size(); ++i)
+      m_index.emplace(m_keys[i], i);
   }
 
   auto expect_find_key(const Key &key) const {
@@ -26,8 +26,56 @@ constexpr auto add_inplace_types =
              std::tuple<float, int64_t>, std::tuple<float, int32_t>,
              std::tuple<double, bool>, std::tuple<int64_t, bool>, Extra...>;
 
+namespace detail {
+/// Sum of a contiguous array, accumulated in independent partial sums.
+///
+/// A single accumulator forms a dependency chain which prevents vectorization
+/// of the loop and exposes the latency of each addition.
+template <class Out, class In>
+Out contiguous_sum(const In *in, const scipp::index size) noexcept {
+  constexpr scipp::index lanes = 8;
+  Out partial[lanes] = {};
+  const scipp::index end = size - size % lanes;
+  for (scipp::index i = 0; i < end; i += lanes)
+    for (scipp::index j = 0; j < lanes; ++j)
+      partial[j] += in[i + j];
+  for (scipp::index i = end; i < size; ++i)
+    partial[0] += in[i];
+  for (scipp::index width = lanes / 2; width > 0; width /= 2)
+    for (scipp::index j = 0; j < width; ++j)
+      partial[j] += partial[j + width];
+  return partial[0];
+}
+
+template <class Out, class In>
+using enable_if_summable_t =
+    std::enable_if_t<std::is_arithmetic_v<Out> && !std::is_same_v<Out, bool> &&
+                     std::is_arithmetic_v<In>>;
+
+/// Kernel for summing a contiguous array into a single element, with separate
+/// streams for values and variances.
+struct sum_into {
+  template <class Out, class In, class = enable_if_summable_t<Out, In>>
+  void operator()(Out *out, const In *in, const scipp::index size) const {
+    *out += contiguous_sum<Out>(in, size);
+  }
+  template <class Out, class In, class = enable_if_summable_t<Out, In>>
+  void operator()(Out *out, Out *, const In *in,
+                  const scipp::index size) const {
+    *out += contiguous_sum<Out>(in, size);
+  }
+  template <class Out, class In, class = enable_if_summable_t<Out, In>>
+  void operator()(Out *out, Out *out_variance, const In *in,
+                  const In *in_variance, const scipp::index size) const {
+    *out += contiguous_sum<Out>(in, size);
+    *out_variance += contiguous_sum<Out>(in_variance, size);
+  }
+};
+} // namespace detail
+
 constexpr auto add_equals = overloaded{add_inplace_types<SubbinSizes>,
-                                       [](auto &&a, const auto &b) { a += b; }};
+                                       [](auto &&a, const auto &b) { a += b; },
+                                       contiguous_reduce{detail::sum_into{}}};
 
 constexpr auto nan_add_equals =
     overloaded{add_inplace_types<>, [](auto &&a, const auto &b) {
@@ -33,62 +33,122 @@ namespace histogram_detail {
 template <class Out, class Coord, class Weight, class Edge>
 using args = std::tuple<scipp::span<Out>, scipp::span<const Coord>,
                         scipp::span<const Weight>, scipp::span<const Edge>>;
+
+constexpr auto fill_linspace = [](const auto &data, const auto &events,
+                                  const auto &weights, const auto &edges) {
+  const auto params = core::linear_edge_params(edges);
+  for (scipp::index i = 0; i < scipp::size(events); ++i) {
+    const auto x = events[i];
+    if (const auto bin = get_bin<scipp::index>(x, edges, params); bin >= 0)
+      iadd(data, bin, weights, i);
+  }
+};
+
+constexpr auto fill_sorted_edges = [](const auto &data, const auto &events,
+                                      const auto &weights, const auto &edges) {
+  for (scipp::index i = 0; i < scipp::size(events); ++i) {
+    const auto x = events[i];
+    auto it = std::upper_bound(edges.begin(), edges.end(), x);
+    if (it != edges.end() && it != edges.begin())
+      iadd(data, --it - edges.begin(), weights, i);
+  }
+};
+
+constexpr auto fill_checked = [](const auto &data, const auto &events,
+                                 const auto &weights, const auto &edges) {
+  // Special implementation for linear bins. Gives a 1x to 20x speedup
+  // for few and many events per histogram, respectively.
+  if (scipp::numeric::islinspace(edges)) {
+    fill_linspace(data, events, weights, edges);
+  } else {
+    core::expect::histogram::sorted_edges(edges);
+    fill_sorted_edges(data, events, weights, edges);
+  }
+};
+
+/// Events multiplied by a unit-conversion factor when accessed.
+///
+/// Yields the same values as converting the events with `to_unit` before
+/// histogramming, without materializing a converted copy.
+template <class T> struct ScaledEvents {
+  scipp::span<const T> events;
+  double scale;
+  [[nodiscard]] T operator[](const scipp::index i) const {
+    return static_cast<T>(events[i] * scale);
+  }
+  [[nodiscard]] auto size() const noexcept { return events.size(); }
+};
+
+template <class Fill> constexpr auto make_histogram(Fill fill) {
+  return overloaded{
+      element::arg_list<
+          args<float, double, float, double>,
+          args<float, float, float, double>,
+          args<float, float, float, float>,
+          args<float, int64_t, float, double>,
+          args<float, int32_t, float, double>,
+          args<float, int64_t, float, int64_t>,
+          args<float, int32_t, float, int32_t>,
+          args<double, double, double, double>,
+          args<double, float, double, double>,
+          args<double, double, double, float>,
+          args<double, float, double, float>,
+          args<double, double, float, double>,
+          args<double, int64_t, double, int64_t>,
+          args<double, int32_t, double, int64_t>,
+          args<double, int64_t, double, int32_t>,
+          args<double, int32_t, double, int32_t>,
+          args<double, time_point, double, time_point>,
+          args<double, time_point, float, time_point>,
+          args<float, time_point, double, time_point>,
+          args<float, time_point, float, time_point>>,
+      [fill](const auto &data, const auto &events, const auto &weights,
+             const auto &edges) {
+        zero(data);
+        fill(data, events, weights, edges);
+      },
+      [](const units::Unit &events_unit, const units::Unit &weights_unit,
+         const units::Unit &edge_unit) {
+        if (events_unit != edge_unit)
+          throw except::UnitError(
+              "Bin edges must have same unit as the input coordinate.");
+        return weights_unit;
+      },
+      transform_flags::expect_in_variance_if_out_variance,
+      transform_flags::expect_no_variance_arg<1>,
+      transform_flags::expect_no_variance_arg<3>};
+}
+
+/// Variant of `make_histogram` for floating-point events in a unit that
+/// differs from the unit of the edges. The events are converted on the fly by
+/// multiplying with `scale`. Units are checked by the caller.
+template <class Fill>
+constexpr auto make_scaled_histogram(Fill fill, const double scale) {
+  return overloaded{
+      element::arg_list<args<float, double, float, double>,
+                        args<float, float, float, double>,
+                        args<float, float, float, float>,
+                        args<double, double, double, double>,
+                        args<double, float, double, double>,
+                        args<double, double, double, float>,
+                        args<double, float, double, float>,
+                        args<double, double, float, double>>,
+      [fill, scale](const auto &data, const auto &events, const auto &weights,
+                    const auto &edges) {
+        using T = std::remove_const_t<
+            typename std::decay_t<decltype(events)>::element_type>;
+        zero(data);
+        fill(data, ScaledEvents<T>{events, scale}, weights, edges);
+      },
+      [](const units::Unit &, const units::Unit &weights_unit,
+         const units::Unit &) { return weights_unit; },
+      transform_flags::expect_in_variance_if_out_variance,
+      transform_flags::expect_no_variance_arg<1>,
+      transform_flags::expect_no_variance_arg<3>};
 }
+} // namespace histogram_detail
 
-static constexpr auto histogram = overloaded{
-    element::arg_list<
-        histogram_detail::args<float, double, float, double>,
-        histogram_detail::args<float, float, float, double>,
-        histogram_detail::args<float, float, float, float>,
-        histogram_detail::args<float, int64_t, float, double>,
-        histogram_detail::args<float, int32_t, float, double>,
-        histogram_detail::args<float, int64_t, float, int64_t>,
-        histogram_detail::args<float, int32_t, float, int32_t>,
-        histogram_detail::args<double, double, double, double>,
-        histogram_detail::args<double, float, double, double>,
-        histogram_detail::args<double, double, double, float>,
-        histogram_detail::args<double, float, double, float>,
-        histogram_detail::args<double, double, float, double>,
-        histogram_detail::args<double, int64_t, double, int64_t>,
-        histogram_detail::args<double, int32_t, double, int64_t>,
-        histogram_detail::args<double, int64_t, double, int32_t>,
-        histogram_detail::args<double, int32_t, double, int32_t>,
-        histogram_detail::args<double, time_point, double, time_point>,
-        histogram_detail::args<double, time_point, float, time_point>,
-        histogram_detail::args<float, time_point, double, time_point>,
-        histogram_detail::args<float, time_point, float, time_point>>,
-    [](const auto &data, const auto &events, const auto &weights,
-       const auto &edges) {
-      zero(data);
-      // Special implementation for linear bins. Gives a 1x to 20x speedup
-      // for few and many events per histogram, respectively.
-      if (scipp::numeric::islinspace(edges)) {
-        const auto params = core::linear_edge_params(edges);
-        for (scipp::index i = 0; i < scipp::size(events); ++i) {
-          const auto x = events[i];
-          if (const auto bin = get_bin<scipp::index>(x, edges, params);
-              bin >= 0)
-            iadd(data, bin, weights, i);
-        }
-      } else {
-        core::expect::histogram::sorted_edges(edges);
-        for (scipp::index i = 0; i < scipp::size(events); ++i) {
-          const auto x = events[i];
-          auto it = std::upper_bound(edges.begin(), edges.end(), x);
-          if (it != edges.end() && it != edges.begin())
-            iadd(data, --it - edges.begin(), weights, i);
-        }
-      }
-    },
-    [](const units::Unit &events_unit, const units::Unit &weights_unit,
-       const units::Unit &edge_unit) {
-      if (events_unit != edge_unit)
-        throw except::UnitError(
-            "Bin edges must have same unit as the input coordinate.");
-      return weights_unit;
-    },
-    transform_flags::expect_in_variance_if_out_variance,
-    transform_flags::expect_no_variance_arg<1>,
-    transform_flags::expect_no_variance_arg<3>};
+static constexpr auto histogram =
+    histogram_detail::make_histogram(histogram_detail::fill_checked);
 
 } // namespace scipp::core::element
@@ -9,6 +9,7 @@
 #include "scipp/core/eigen.h"
 #include "scipp/core/element/arg_list.h"
 #include "scipp/core/transform_common.h"
+#include "scipp/core/vectorized_math.h"
 #include <Eigen/Geometry>
 #include <cmath>
 
@@ -110,16 +111,24 @@ constexpr auto reciprocal = overloaded{
 constexpr auto exp =
     overloaded{arg_list<double, float>, dimensionless_unit_check_return,
                [](const auto &x) {
-                 using std::exp;
+                 using vectorized_math::exp;
                  return exp(x);
-               }};
+               },
+               contiguous_unary{[](const auto *in, auto *out,
+                                   const scipp::index size) {
+                 vectorized_math::exp(in, out, size);
+               }}};
 
 constexpr auto log =
     overloaded{arg_list<double, float>, dimensionless_unit_check_return,
                [](const auto &x) {
-                 using std::log;
+                 using vectorized_math::log;
                  return log(x);
-               }};
+               },
+               contiguous_unary{[](const auto *in, auto *out,
+                                   const scipp::index size) {
+                 vectorized_math::log(in, out, size);
+               }}};
 
 constexpr auto log10 =
     overloaded{arg_list<double, float>, dimensionless_unit_check_return,
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "scipp/common/overloaded.h"
+#include "scipp/common/span.h"
+#include "scipp/core/element/arg_list.h"
+#include "scipp/core/transform_common.h"
+#include "scipp/units/unit.h"
+
+namespace scipp::core::element {
+
+namespace quantile_detail {
+template <class T>
+using out_type = std::conditional_t<std::is_same_v<T, float>, float, double>;
+
+/// Return the `q`-quantile of the values in `buffer`, reordering the buffer.
+///
+/// Uses linear interpolation between the two closest ranks, which is the
+/// default method of `numpy.quantile`. Instead of sorting, the lower rank is
+/// found using a selection algorithm (introselect) and the upper rank as the
+/// minimum of the remaining upper partition, i.e., this is O(N).
+template <class T> auto select(std::vector<T> &buffer, const double q) {
+  using Out = out_type<T>;
+  if (buffer.empty())
+    return std::numeric_limits<Out>::quiet_NaN();
+  const auto pos = q * static_cast<double>(buffer.size() - 1);
+  const auto lo = static_cast<scipp::index>(pos);
+  const auto nth = buffer.begin() + lo;
+  std::nth_element(buffer.begin(), nth, buffer.end());
+  const auto lower = static_cast<double>(*nth);
+  if (nth + 1 == buffer.end() || pos == static_cast<double>(lo))
+    return static_cast<Out>(lower);
+  const auto upper =
+      static_cast<double>(*std::min_element(nth + 1, buffer.end()));
+  const auto fraction = pos - static_cast<double>(lo);
+  return static_cast<Out>(lower + fraction * (upper - lower));
+}
+
+/// Return the `q`-quantile of the unmasked elements of `values`.
+///
+/// The selection operates on a thread-local scratch buffer, such that the
+/// allocation is reused for all outputs computed by a thread. If `SkipNaN` is
+/// false any NaN yields a NaN result, otherwise NaNs are ignored.
+template <bool SkipNaN, class Values, class Mask>
+auto quantile(const Values &values, const Mask &mask, const double q) {
+  using T = std::remove_const_t<typename Values::element_type>;
+  thread_local std::vector<T> buffer;
+  buffer.clear();
+  for (scipp::index i = 0; i < scipp::size(values); ++i) {
+    if (mask(i))
+      continue;
+    const auto x = values[i];
+    if constexpr (std::is_floating_point_v<T>) {
+      if (std::isnan(x)) {
+        if constexpr (SkipNaN)
+          continue;
+        else
+          return std::numeric_limits<out_type<T>>::quiet_NaN();
+      }
+    }
+    buffer.push_back(x);
+  }
+  return select(buffer, q);
+}
+
+template <class... Ts>
+constexpr arg_list_t<std::tuple<scipp::span<const Ts>,
+                                scipp::span<const bool>>...>
+    masked_arg_list{};
+} // namespace quantile_detail
+
+/// Return element operation computing the `q`-quantile of each span.
+template <bool SkipNaN> auto make_quantile(const double q) {
+  return overloaded{
+      arg_list<scipp::span<const double>, scipp::span<const float>,
+               scipp::span<const int64_t>, scipp::span<const int32_t>>,
+      transform_flags::expect_no_variance_arg<0>,
+      [](const units::Unit &u) { return u; },
+      [q](const auto &values) {
+        return quantile_detail::quantile<SkipNaN>(
+            values, [](const scipp::index) { return false; }, q);
+      }};
+}
+
+/// Return element operation computing the `q`-quantile of each span, ignoring
+/// elements for which the corresponding mask is true.
+template <bool SkipNaN> auto make_masked_quantile(const double q) {
+  return overloaded{
+      quantile_detail::masked_arg_list<double, float, int64_t, int32_t>,
+      transform_flags::expect_no_variance_arg<0>,
+      transform_flags::expect_no_variance_arg<1>,
+      [](const units::Unit &u, const units::Unit &) { return u; },
+      [q](const auto &values, const auto &mask) {
+        return quantile_detail::quantile<SkipNaN>(
+            values, [&mask](const scipp::index i) { return mask[i]; }, q);
+      }};
+}
+
+} // namespace scipp::core::element
@@ -9,6 +9,7 @@
 #include "scipp/common/overloaded.h"
 #include "scipp/core/element/arg_list.h"
 #include "scipp/core/transform_common.h"
+#include "scipp/core/vectorized_math.h"
 
 namespace scipp::core::element {
 constexpr auto trig = overloaded{arg_list<double, float>,
@@ -16,15 +17,25 @@ constexpr auto trig = overloaded{arg_list<double, float>,
                                  transform_flags::expect_no_variance_arg<1>,
                                  transform_flags::expect_no_variance_arg<2>};
 
-constexpr auto sin = overloaded{trig, [](const auto &x) {
-                                  using std::sin;
-                                  return sin(x);
-                                }};
+constexpr auto sin = overloaded{
+    trig,
+    [](const auto &x) {
+      using vectorized_math::sin;
+      return sin(x);
+    },
+    contiguous_unary{[](const auto *in, auto *out, const scipp::index size) {
+      vectorized_math::sin(in, out, size);
+    }}};
 
-constexpr auto cos = overloaded{trig, [](const auto &x) {
-                                  using std::cos;
-                                  return cos(x);
-                                }};
+constexpr auto cos = overloaded{
+    trig,
+    [](const auto &x) {
+      using vectorized_math::cos;
+      return cos(x);
+    },
+    contiguous_unary{[](const auto *in, auto *out, const scipp::index size) {
+      vectorized_math::cos(in, out, size);
+    }}};
 
 constexpr auto tan = overloaded{trig, [](const auto &x) {
                                   using std::tan;
@@ -6,8 +6,10 @@
 
 #include <algorithm>
 #include <memory>
+#include <type_traits>
 
 #include "scipp/common/index.h"
+#include "scipp/core/large_allocation.h"
 #include "scipp/core/parallel.h"
 
 namespace scipp::core {
@@ -28,6 +30,19 @@ auto make_unique_for_overwrite_array(const scipp::index size) {
       "Allocation size is either negative or exceeds PTRDIFF_MAX");
 }
 
+/// Deleter for buffers of element_array.
+///
+/// Large buffers may be allocated by allocate_huge_pages instead of new[].
+template <class T> struct array_deleter {
+  bool huge_pages{false};
+  void operator()(T *ptr) const noexcept {
+    if (huge_pages)
+      deallocate_huge_pages(ptr);
+    else
+      delete[] ptr;
+  }
+};
+
 /// Tag for requesting default-initialization in methods of class element_array.
 struct init_for_overwrite_t {};
 static constexpr auto init_for_overwrite = init_for_overwrite_t{};
@@ -55,7 +70,8 @@ public:
     parallel::parallel_for(
         parallel::blocked_range(0, size()), [&](const auto &range) {
           std::fill(data() + range.begin(), data() + range.end(), value);
-        });
+        },
+        parallel::static_partitioner{});
   }
 
   /// Construct with default-initialized elements.
@@ -75,7 +91,8 @@ public:
         parallel::blocked_range(0, size), [&](const auto &range) {
           std::copy(first + range.begin(), first + range.end(),
                     data() + range.begin());
-        });
+        },
+        parallel::static_partitioner{});
   }
 
   template <
@@ -136,12 +153,59 @@ public:
       m_data.reset();
       m_size = 0;
     } else if (new_size != size()) {
-      m_data = make_unique_for_overwrite_array<T>(new_size);
+      m_data = allocate_for_overwrite(new_size);
       m_size = new_size;
+      first_touch();
     }
   }
 
 private:
+  using Ptr = std::unique_ptr<T[], array_deleter<T>>;
+
+  /// Allocate a buffer with default-initialized elements.
+  ///
+  /// Large buffers of trivial types are aligned to huge pages, which avoids
+  /// most page faults and TLB misses on random access, e.g., when scattering
+  /// events into bins.
+  static Ptr allocate_for_overwrite(const scipp::index size) {
+    if constexpr (std::is_trivially_default_constructible_v<T> &&
+                  std::is_trivially_destructible_v<T>) {
+      if (size >= 0 && size <= PTRDIFF_MAX / scipp::index(sizeof(T)))
+        if (void *ptr = allocate_huge_pages(size * sizeof(T)))
+          return Ptr(static_cast<T *>(ptr), array_deleter<T>{true});
+    }
+    return Ptr(make_unique_for_overwrite_array<T>(size).release());
+  }
+
+  /// Write to every memory page of a large uninitialized buffer, using the
+  /// same partitioning of the index range that is used when filling it, e.g.,
+  /// in transform.
+  ///
+  /// On NUMA systems a page is placed on the node of the thread that writes
+  /// to it first. Without this, the placement of all pages could be decided
+  /// by whichever thread happens to be first, and threads on other sockets
+  /// would subsequently access remote memory. This also prefaults the pages
+  /// in parallel, it can be disabled with large_allocation_config().prefault.
+  void first_touch() {
+    if constexpr (std::is_trivially_default_constructible_v<T>) {
+      constexpr scipp::index page_size = 4096;
+      constexpr scipp::index first_touch_threshold = 4 * 1024 * 1024;
+      if (!large_allocation_config().prefault ||
+          size() * scipp::index(sizeof(T)) < first_touch_threshold)
+        return;
+      auto *bytes = reinterpret_cast<char *>(data());
+      parallel::parallel_for(
+          parallel::blocked_range(0, size()),
+          [&](const auto &range) {
+            const auto end = range.end() * scipp::index(sizeof(T));
+            for (auto i = range.begin() * scipp::index(sizeof(T)); i < end;
+                 i += page_size)
+              bytes[i] = 0;
+          },
+          parallel::static_partitioner{});
+    }
+  }
+
   element_array from_other(const element_array &other) {
     if (other.size() == -1) {
       return element_array();
@@ -152,7 +216,7 @@ private:
     }
   }
   scipp::index m_size{-1};
-  std::unique_ptr<T[]> m_data;
+  Ptr m_data;
 };
 
 } // namespace scipp::core
@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <cstddef>
+
+#include "scipp-core_export.h"
+#include "scipp/common/index.h"
+
+namespace scipp::core {
+
+/// Settings for the allocation of large buffers of element_array.
+///
+/// These are global settings and should be changed only while no buffers are
+/// being allocated, e.g., at startup.
+struct SCIPP_CORE_EXPORT LargeAllocationConfig {
+  /// Buffers of at least this many bytes are aligned to 2 MiB and marked as
+  /// eligible for transparent huge pages. Negative values disable this.
+  scipp::index huge_page_threshold{64 * 1024 * 1024};
+  /// If true, the pages of large uninitialized buffers are touched in
+  /// parallel right after allocation instead of on first use.
+  bool prefault{true};
+};
+
+[[nodiscard]] SCIPP_CORE_EXPORT LargeAllocationConfig &
+large_allocation_config();
+
+[[nodiscard]] SCIPP_CORE_EXPORT void *
+allocate_huge_pages(std::size_t size);
+
+SCIPP_CORE_EXPORT void deallocate_huge_pages(void *ptr) noexcept;
+
+} // namespace scipp::core
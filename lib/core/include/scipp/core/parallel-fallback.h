@@ -26,10 +26,18 @@ private:
   scipp::index m_end;
 };
 
+struct static_partitioner {};
+struct affinity_partitioner {};
+
 template <class Op> void parallel_for(const blocked_range &range, Op &&op) {
   op(range);
 }
 
+template <class Op, class Partitioner>
+void parallel_for(const blocked_range &range, Op &&op, Partitioner &&) {
+  op(range);
+}
+
 template <class... Args> void parallel_sort(Args &&...args) {
   std::sort(std::forward<Args>(args)...);
 }
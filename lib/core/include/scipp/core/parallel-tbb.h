@@ -26,6 +26,17 @@ inline auto blocked_range(const scipp::index begin, const scipp::index end,
                       : grainsize);
 }
 
+/// Partitioner assigning the same chunks of a range to the same threads every
+/// time, provided that the range and grain-size are the same. Used to make
+/// the thread writing a buffer the one that first touched its memory pages,
+/// which places the pages on that thread's NUMA node.
+using static_partitioner = tbb::static_partitioner;
+
+/// Partitioner replaying the chunk-to-thread mapping of previous loops it was
+/// used with. The same instance must be passed to repeated loops over the
+/// same data to benefit from cache and NUMA locality.
+using affinity_partitioner = tbb::affinity_partitioner;
+
 template <class... Args> void parallel_for(Args &&...args) {
   tbb::parallel_for(std::forward<Args>(args)...);
 }
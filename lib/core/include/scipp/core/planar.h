@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <cmath>
+
+#include <Eigen/Core>
+
+#include "scipp/common/index.h"
+#include "scipp/core/parallel.h"
+
+/// Kernels for arrays of vectors stored in "planar" (structure-of-arrays)
+/// layout, i.e., with all x-components in one contiguous array, all
+/// y-components in a second array, and so on.
+///
+/// In contrast to the array-of-structures layout used for Eigen::Vector3d,
+/// the loops below operate on contiguous arrays of double and can therefore be
+/// vectorized by the compiler. All kernels process the index range [begin, end)
+/// so they can be used directly as the body of a parallel_for.
+namespace scipp::core::planar {
+
+/// Pointers to the x, y, and z component planes of an array of vectors.
+template <class T> struct Planes {
+  T *x;
+  T *y;
+  T *z;
+};
+
+inline void dot(const Planes<const double> a, const Planes<const double> b,
+                double *out, const scipp::index begin,
+                const scipp::index end) {
+  for (scipp::index i = begin; i < end; ++i)
+    out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+}
+
+inline void norm(const Planes<const double> a, double *out,
+                 const scipp::index begin, const scipp::index end) {
+  for (scipp::index i = begin; i < end; ++i)
+    out[i] = std::sqrt(a.x[i] * a.x[i] + a.y[i] * a.y[i] + a.z[i] * a.z[i]);
+}
+
+inline void cross(const Planes<const double> a, const Planes<const double> b,
+                  const Planes<double> out, const scipp::index begin,
+                  const scipp::index end) {
+  for (scipp::index i = begin; i < end; ++i) {
+    // Load into locals first since `out` may alias `a` or `b`.
+    const double ax = a.x[i];
+    const double ay = a.y[i];
+    const double az = a.z[i];
+    const double bx = b.x[i];
+    const double by = b.y[i];
+    const double bz = b.z[i];
+    out.x[i] = ay * bz - az * by;
+    out.y[i] = az * bx - ax * bz;
+    out.z[i] = ax * by - ay * bx;
+  }
+}
+
+/// Compute `out = matrix * a + translation` for every vector in `a`.
+///
+/// The coefficients are hoisted out of the loop into scalars, so the loop body
+/// is a plain sequence of fused multiply-adds on contiguous arrays.
+inline void apply(const Eigen::Matrix3d &matrix,
+                  const Eigen::Vector3d &translation,
+                  const Planes<const double> a, const Planes<double> out,
+                  const scipp::index begin, const scipp::index end) {
+  const double m00 = matrix(0, 0);
+  const double m01 = matrix(0, 1);
+  const double m02 = matrix(0, 2);
+  const double m10 = matrix(1, 0);
+  const double m11 = matrix(1, 1);
+  const double m12 = matrix(1, 2);
+  const double m20 = matrix(2, 0);
+  const double m21 = matrix(2, 1);
+  const double m22 = matrix(2, 2);
+  const double t0 = translation[0];
+  const double t1 = translation[1];
+  const double t2 = translation[2];
+  for (scipp::index i = begin; i < end; ++i) {
+    const double x = a.x[i];
+    const double y = a.y[i];
+    const double z = a.z[i];
+    out.x[i] = m00 * x + m01 * y + m02 * z + t0;
+    out.y[i] = m10 * x + m11 * y + m12 * z + t1;
+    out.z[i] = m20 * x + m21 * y + m22 * z + t2;
+  }
+}
+
+/// Compute `out = matrix * a + translation` for vectors in interleaved
+/// (array-of-structures) layout, i.e., for the memory of Eigen::Vector3d.
+///
+/// Blocks of vectors are transposed into planar layout in local buffers, so
+/// the arithmetic on each block vectorizes as in the planar kernel above.
+/// `in` and `out` point to the first component of the vector with index 0.
+inline void apply_interleaved(const Eigen::Matrix3d &matrix,
+                              const Eigen::Vector3d &translation,
+                              const double *in, double *out,
+                              const scipp::index begin,
+                              const scipp::index end) {
+  constexpr scipp::index block = 8;
+  double x[block];
+  double y[block];
+  double z[block];
+  double res[3][block];
+  const Planes<const double> local_in{x, y, z};
+  const Planes<double> local_out{res[0], res[1], res[2]};
+  scipp::index i = begin;
+  for (; i + block <= end; i += block) {
+    for (scipp::index k = 0; k < block; ++k) {
+      x[k] = in[3 * (i + k)];
+      y[k] = in[3 * (i + k) + 1];
+      z[k] = in[3 * (i + k) + 2];
+    }
+    apply(matrix, translation, local_in, local_out, 0, block);
+    for (scipp::index k = 0; k < block; ++k) {
+      out[3 * (i + k)] = res[0][k];
+      out[3 * (i + k) + 1] = res[1][k];
+      out[3 * (i + k) + 2] = res[2][k];
+    }
+  }
+  const scipp::index rest = end - i;
+  for (scipp::index k = 0; k < rest; ++k) {
+    x[k] = in[3 * (i + k)];
+    y[k] = in[3 * (i + k) + 1];
+    z[k] = in[3 * (i + k) + 2];
+  }
+  apply(matrix, translation, local_in, local_out, 0, rest);
+  for (scipp::index k = 0; k < rest; ++k) {
+    out[3 * (i + k)] = res[0][k];
+    out[3 * (i + k) + 1] = res[1][k];
+    out[3 * (i + k) + 2] = res[2][k];
+  }
+}
+
+/// Run `kernel(begin, end)` over `size` elements, in parallel for large sizes.
+template <class Kernel>
+void for_each_block(const scipp::index size, Kernel &&kernel) {
+  // Blocks must be large enough to amortize the scheduling overhead but the
+  // kernels above are cheap, so a fixed minimum grain size is used.
+  constexpr scipp::index grainsize = 4096;
+  if (size <= grainsize)
+    return kernel(scipp::index{0}, size);
+  parallel::parallel_for(parallel::blocked_range(0, size, grainsize),
+                         [&](const auto &range) {
+                           kernel(range.begin(), range.end());
+                         });
+}
+
+} // namespace scipp::core::planar
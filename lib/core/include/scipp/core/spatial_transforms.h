@@ -147,6 +147,31 @@ operator*(const T_LHS &lhs, const T_RHS &rhs) {
   return Translation(lhs.vector() + rhs.vector());
 }
 
+/// Return the linear part and the translation of a spatial transform.
+///
+/// For any vector v, `transform * v == linear * v + translation`. Chains of
+/// transforms can be combined with operator* first and then be decomposed
+/// once, so the chain is applied to many vectors in a single pass.
+[[nodiscard]] inline std::pair<Eigen::Matrix3d, Eigen::Vector3d>
+linear_and_translation(const Eigen::Matrix3d &transform) {
+  return {transform, Eigen::Vector3d::Zero()};
+}
+
+[[nodiscard]] inline std::pair<Eigen::Matrix3d, Eigen::Vector3d>
+linear_and_translation(const Eigen::Affine3d &transform) {
+  return {transform.linear(), transform.translation()};
+}
+
+[[nodiscard]] inline std::pair<Eigen::Matrix3d, Eigen::Vector3d>
+linear_and_translation(const Quaternion &transform) {
+  return {transform.quat().toRotationMatrix(), Eigen::Vector3d::Zero()};
+}
+
+[[nodiscard]] inline std::pair<Eigen::Matrix3d, Eigen::Vector3d>
+linear_and_translation(const Translation &transform) {
+  return {Eigen::Matrix3d::Identity(), transform.vector()};
+}
+
 template <> inline constexpr DType dtype<Eigen::Matrix3d>{4001};
 template <> inline constexpr DType dtype<Eigen::Affine3d>{4002};
 template <> inline constexpr DType dtype<Translation>{4003};
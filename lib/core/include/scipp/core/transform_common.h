@@ -67,6 +67,42 @@ template <typename Op> struct assign_unary : Op {
 };
 template <typename Op> assign_unary(Op) -> assign_unary<Op>;
 
+/// Kernel of a unary operation for contiguous arrays, added as an overload to
+/// the operator.
+///
+/// If the input and output of an inner loop of transform are contiguous and
+/// have no variances, transform calls `op.contiguous(out, in, size)` instead of
+/// calling the operator for every element. This allows for using vectorized
+/// implementations. `kernel` must return the same results as the element-wise
+/// overloads of the operator.
+template <class Kernel> struct contiguous_unary {
+  void operator()() const {};
+  template <class T>
+  void contiguous(T *out, const T *in, const scipp::index size) const {
+    kernel(in, out, size);
+  }
+  Kernel kernel;
+};
+template <class Kernel> contiguous_unary(Kernel) -> contiguous_unary<Kernel>;
+
+/// Kernel of an in-place operation reducing a contiguous array into a single
+/// element, added as an overload to the operator.
+///
+/// If the inner loop of an in-place transform has output stride 0 and
+/// contiguous inputs, as in a reduction along the inner dimension, transform
+/// calls `op.reduce(out..., in..., size)`. The arguments are pointers to the
+/// values and, if present, the variances of the output and inputs. Kernels may
+/// reorder operations, e.g., to accumulate into independent partial sums.
+template <class Kernel> struct contiguous_reduce {
+  Kernel kernel;
+  void operator()() const {};
+  template <class... Args>
+  auto reduce(Args... args) const -> decltype(kernel(args...)) {
+    return kernel(args...);
+  }
+};
+template <class Kernel> contiguous_reduce(Kernel) -> contiguous_reduce<Kernel>;
+
 /// Flags for transform, added as overloads to the operator. These are never
 /// actually called since flag presence is checked via the base class of the
 /// operator.
@@ -8,6 +8,7 @@
 #include "scipp/common/numeric.h"
 #include "scipp/common/span.h"
 #include "scipp/core/dtype.h"
+#include "scipp/core/vectorized_math.h"
 
 namespace scipp::core {
 
@@ -87,14 +88,13 @@ template <class T> constexpr auto abs(const ValueAndVariance<T> a) noexcept {
 }
 
 template <typename T> constexpr auto exp(const ValueAndVariance<T> a) noexcept {
-  using std::exp;
-  const auto val = exp(a.value);
+  const auto val = vectorized_math::exp(a.value);
   return ValueAndVariance(val, val * val * a.variance);
 }
 
 template <typename T> constexpr auto log(const ValueAndVariance<T> a) noexcept {
-  using std::log;
-  return ValueAndVariance(log(a.value), a.variance / (a.value * a.value));
+  return ValueAndVariance(vectorized_math::log(a.value),
+                          a.variance / (a.value * a.value));
 }
 
 template <typename T>
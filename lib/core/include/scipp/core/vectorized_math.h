@@ -0,0 +1,264 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "scipp/common/index.h"
+
+/// Implementations of exp, log, sin, and cos that can be vectorized by the
+/// compiler.
+///
+/// The functions of the standard library are opaque calls, so loops calling
+/// them cannot be vectorized. The implementations below consist of plain
+/// arithmetic and bit manipulation without branches and without calls. They are
+/// valid for a "fast domain" of inputs, other inputs such as NaN, infinities,
+/// or results in the subnormal range are handled by the standard library:
+///
+/// - exp: -707 <= x <= 709, max error < 1 ULP.
+/// - log: finite x with x >= DBL_MIN, max error < 1 ULP.
+/// - sin, cos: 0 < |x| <= 2^19, max error < 1 ULP.
+///
+/// The error bounds are verified by the tests against the standard library.
+/// The float overloads compute in double precision and round the result.
+///
+/// The scalar and the array overloads return bitwise identical results. The
+/// array overloads process blocks of elements: A vectorized loop computes all
+/// elements, a second pass recomputes elements outside the fast domain.
+namespace scipp::core::vectorized_math {
+
+namespace detail {
+inline double as_double(const std::uint64_t bits) noexcept {
+  double x;
+  std::memcpy(&x, &bits, sizeof(x));
+  return x;
+}
+
+inline std::uint64_t as_bits(const double x) noexcept {
+  std::uint64_t bits;
+  std::memcpy(&bits, &x, sizeof(x));
+  return bits;
+}
+
+/// Adding and subtracting this rounds to the nearest integer for |x| < 2^51.
+/// The low bits of `x + shift` hold the integer in two's complement.
+constexpr double shift = 0x1.8p52;
+
+constexpr double ln2_hi = 0x1.62e42ffp-1; // exact product with |k| < 2^20
+constexpr double ln2_lo = -0x1.718432a1b0e26p-35;
+constexpr double log2e = 1.4426950408889634;
+
+// pi/2 = pio2_1 + pio2_2 + pio2_3 + pio2_3t, the first three have 33 bits.
+constexpr double two_over_pi = 0.6366197723675814;
+constexpr double pio2_1 = 0x1.921fb544p+0;
+constexpr double pio2_2 = 0x1.0b4611a6p-34;
+constexpr double pio2_3 = 0x1.3198a2ep-69;
+constexpr double pio2_3t = 0x1.b839a252049c1p-104;
+
+/// Evaluate the polynomial c0 + c1 x + c2 x^2 + ... with Horner's scheme.
+template <class... C>
+constexpr double horner(const double x, const double c0, const C... c) {
+  if constexpr (sizeof...(C) == 0)
+    return c0;
+  else
+    return c0 + x * horner(x, c...);
+}
+
+// The domain checks use bitwise instead of logical operators, since the
+// latter introduce control flow which prevents vectorization.
+inline bool exp_fast_domain(const double x) noexcept {
+  return (x >= -707.0) & (x <= 709.0);
+}
+
+inline double exp_fast(const double x) noexcept {
+  const double kd = x * log2e + shift;
+  const double k = kd - shift;
+  const double r = (x - k * ln2_hi) - k * ln2_lo;
+  // Taylor polynomial of exp(r) - 1 for |r| <= ln(2)/2.
+  const double p =
+      r + r * r *
+              horner(r, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720,
+                     1.0 / 5040, 1.0 / 40320, 1.0 / 362880, 1.0 / 3628800,
+                     1.0 / 39916800, 1.0 / 479001600, 1.0 / 6227020800);
+  // 2^k from the low bits of kd, valid for -1022 <= k <= 1023.
+  const double scale = as_double((as_bits(kd) + 1023) << 52);
+  return (1.0 + p) * scale;
+}
+
+inline bool log_fast_domain(const double x) noexcept {
+  return (x >= std::numeric_limits<double>::min()) &
+         (x <= std::numeric_limits<double>::max());
+}
+
+inline double log_fast(const double x) noexcept {
+  // Reduce to x = 2^e * m with sqrt(2)/2 <= m < sqrt(2) by offsetting the bits
+  // such that the exponent field of mantissas >= sqrt(2) is incremented.
+  const std::uint64_t bits =
+      as_bits(x) + (0x3ff0000000000000ull - 0x3fe6a09e00000000ull);
+  const double m =
+      as_double((bits & 0x000fffffffffffffull) + 0x3fe6a09e00000000ull);
+  // Exponent converted to double without int-to-float conversion.
+  const double e =
+      (as_double(0x4330000000000000ull | (bits >> 52)) - 0x1p52) - 1023.0;
+  // log(m) = log(1 + f) = 2 atanh(s) with s = f / (2 + f).
+  const double f = m - 1.0;
+  const double s = f / (2.0 + f);
+  const double z = s * s;
+  const double R = z * horner(z, 2.0 / 3, 2.0 / 5, 2.0 / 7, 2.0 / 9, 2.0 / 11,
+                              2.0 / 13, 2.0 / 15, 2.0 / 17, 2.0 / 19,
+                              2.0 / 21, 2.0 / 23);
+  const double hfsq = 0.5 * f * f;
+  return e * ln2_hi - ((hfsq - (s * (hfsq + R) + e * ln2_lo)) - f);
+}
+
+inline bool sincos_fast_domain(const double x) noexcept {
+  return (x != 0.0) & (std::abs(x) <= 0x1p19);
+}
+
+/// Return sin(x) if `cosine` is false, else cos(x).
+inline double sincos_fast(const double x, const bool cosine) noexcept {
+  // Reduce to x = n pi/2 + r + r_lo with |r| <= pi/4. The products of n with
+  // the 33-bit parts of pi/2 are exact since |n| < 2^20.
+  const double kd = x * two_over_pi + shift;
+  const double n = kd - shift;
+  const double r1 = x - n * pio2_1;
+  const double t = n * pio2_2;
+  const double r2 = r1 - t;
+  // Rounding error of r2, computed with TwoSum.
+  const double bb = r2 - r1;
+  const double err = (r1 - (r2 - bb)) + (-t - bb);
+  const double low = (err - n * pio2_3) - n * pio2_3t;
+  const double r = r2 + low;
+  const double r_lo = (r2 - r) + low;
+
+  const double z = r * r;
+  // Taylor polynomials for |r| <= pi/4, corrected to first order in r_lo.
+  const double sin_r =
+      r + ((r * z) * horner(z, -1.0 / 6, 1.0 / 120, -1.0 / 5040,
+                            1.0 / 362880, -1.0 / 39916800, 1.0 / 6227020800,
+                            -1.0 / 1307674368000, 1.0 / 355687428096000) +
+           r_lo * (1.0 - 0.5 * z));
+  const double hz = 0.5 * z;
+  const double w = 1.0 - hz;
+  const double cos_tail =
+      z * z *
+      horner(z, 1.0 / 24, -1.0 / 720, 1.0 / 40320, -1.0 / 3628800,
+             1.0 / 479001600, -1.0 / 87178291200, 1.0 / 20922789888000,
+             -1.0 / 6402373705728000);
+  const double cos_r = w + (((1.0 - w) - hz) + (cos_tail - r * r_lo));
+
+  // Select by quadrant n mod 4, from the low bits of kd. cos(x) = sin(x+pi/2).
+  const std::uint64_t q = as_bits(kd) + (cosine ? 1 : 0);
+  const std::uint64_t use_cos = 0 - (q & 1);
+  const std::uint64_t value =
+      (as_bits(cos_r) & use_cos) | (as_bits(sin_r) & ~use_cos);
+  return as_double(value ^ ((q & 2) << 62));
+}
+
+/// Apply `fast` to a block of inputs and recompute inputs outside the fast
+/// domain with `fallback`.
+///
+/// Results are stored in a local buffer first, so `in` and `out` may alias.
+template <class T, class Fast, class Domain, class Fallback>
+void apply(const T *in, T *out, const scipp::index size, Fast fast,
+           Domain domain, Fallback fallback) {
+  constexpr scipp::index block = 256;
+  T buffer[block];
+  for (scipp::index begin = 0; begin < size; begin += block) {
+    const auto n = std::min(block, size - begin);
+    const T *x = in + begin;
+    for (scipp::index i = 0; i < n; ++i)
+      buffer[i] = static_cast<T>(fast(static_cast<double>(x[i])));
+    scipp::index outside = 0;
+    for (scipp::index i = 0; i < n; ++i)
+      outside += domain(static_cast<double>(x[i])) ? 0 : 1;
+    if (outside != 0)
+      for (scipp::index i = 0; i < n; ++i)
+        if (!domain(static_cast<double>(x[i])))
+          buffer[i] = fallback(x[i]);
+    std::copy(buffer, buffer + n, out + begin);
+  }
+}
+} // namespace detail
+
+template <class T> T exp(const T x) noexcept {
+  using std::exp;
+  const auto xd = static_cast<double>(x);
+  return detail::exp_fast_domain(xd) ? static_cast<T>(detail::exp_fast(xd))
+                                     : exp(x);
+}
+
+template <class T> T log(const T x) noexcept {
+  using std::log;
+  const auto xd = static_cast<double>(x);
+  return detail::log_fast_domain(xd) ? static_cast<T>(detail::log_fast(xd))
+                                     : log(x);
+}
+
+template <class T> T sin(const T x) noexcept {
+  using std::sin;
+  const auto xd = static_cast<double>(x);
+  return detail::sincos_fast_domain(xd)
+             ? static_cast<T>(detail::sincos_fast(xd, false))
+             : sin(x);
+}
+
+template <class T> T cos(const T x) noexcept {
+  using std::cos;
+  const auto xd = static_cast<double>(x);
+  return detail::sincos_fast_domain(xd)
+             ? static_cast<T>(detail::sincos_fast(xd, true))
+             : cos(x);
+}
+
+template <class T>
+void exp(const T *in, T *out, const scipp::index size) noexcept {
+  detail::apply(
+      in, out, size, detail::exp_fast, detail::exp_fast_domain,
+      [](const T x) {
+        using std::exp;
+        return exp(x);
+      });
+}
+
+template <class T>
+void log(const T *in, T *out, const scipp::index size) noexcept {
+  detail::apply(
+      in, out, size, detail::log_fast, detail::log_fast_domain,
+      [](const T x) {
+        using std::log;
+        return log(x);
+      });
+}
+
+template <class T>
+void sin(const T *in, T *out, const scipp::index size) noexcept {
+  detail::apply(
+      in, out, size,
+      [](const double x) { return detail::sincos_fast(x, false); },
+      detail::sincos_fast_domain,
+      [](const T x) {
+        using std::sin;
+        return sin(x);
+      });
+}
+
+template <class T>
+void cos(const T *in, T *out, const scipp::index size) noexcept {
+  detail::apply(
+      in, out, size,
+      [](const double x) { return detail::sincos_fast(x, true); },
+      detail::sincos_fast_domain,
+      [](const T x) {
+        using std::cos;
+        return cos(x);
+      });
+}
+
+} // namespace scipp::core::vectorized_math
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include "scipp/core/large_allocation.h"
+
+#include <cstdlib>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace scipp::core {
+
+LargeAllocationConfig &large_allocation_config() {
+  static LargeAllocationConfig config;
+  return config;
+}
+
+/// Allocate `size` bytes aligned to the huge page size.
+///
+/// Returns nullptr if `size` is below the configured threshold or huge pages
+/// are not supported on this platform. Memory returned by this function must
+/// be released with deallocate_huge_pages.
+void *allocate_huge_pages(const std::size_t size) {
+#ifdef __linux__
+  constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+  const auto threshold = large_allocation_config().huge_page_threshold;
+  if (threshold < 0 || size < static_cast<std::size_t>(threshold))
+    return nullptr;
+  // aligned_alloc requires the size to be a multiple of the alignment.
+  const auto padded =
+      (size + huge_page_size - 1) / huge_page_size * huge_page_size;
+  void *ptr = std::aligned_alloc(huge_page_size, padded);
+  if (ptr == nullptr)
+    throw std::bad_alloc();
+  // This is only a hint. It fails if transparent huge pages are disabled, in
+  // which case we simply get regular pages.
+  madvise(ptr, padded, MADV_HUGEPAGE);
+  return ptr;
+#else
+  static_cast<void>(size);
+  return nullptr;
+#endif
+}
+
+void deallocate_huge_pages(void *ptr) noexcept { std::free(ptr); }
+
+} // namespace scipp::core
@@ -577,3 +577,85 @@ TEST(Dict, transform_iterator_throws_if_element_added) {
   EXPECT_THROW_DISCARD(++it, std::runtime_error);
   EXPECT_THROW_DISCARD(*it, std::runtime_error);
 }
+
+namespace {
+// Large enough to use a hash table for lookup.
+DimDict make_large_dict(const int size) {
+  DimDict dict;
+  for (int i = 0; i < size; ++i)
+    dict.insert_or_assign(Dim("dim" + std::to_string(i)), i);
+  return dict;
+}
+} // namespace
+
+TEST(Dict, large_dict_can_get_elements) {
+  const auto dict = make_large_dict(100);
+  EXPECT_EQ(dict.size(), 100);
+  for (int i = 0; i < 100; ++i)
+    EXPECT_EQ(dict[Dim("dim" + std::to_string(i))], i);
+  EXPECT_FALSE(dict.contains(Dim::X));
+  EXPECT_EQ(dict.find(Dim::X), dict.end());
+  EXPECT_EQ(dict.find(Dim("dim1")), ++dict.begin());
+}
+
+TEST(Dict, large_dict_can_modify_existing_element) {
+  auto dict = make_large_dict(100);
+  dict.insert_or_assign(Dim("dim50"), -50);
+  EXPECT_EQ(dict.size(), 100);
+  EXPECT_EQ(dict[Dim("dim50")], -50);
+}
+
+TEST(Dict, large_dict_erase_updates_positions) {
+  auto dict = make_large_dict(100);
+  dict.erase(Dim("dim0"));
+  dict.erase(Dim("dim50"));
+  EXPECT_EQ(dict.size(), 98);
+  EXPECT_FALSE(dict.contains(Dim("dim0")));
+  EXPECT_FALSE(dict.contains(Dim("dim50")));
+  for (int i = 1; i < 100; ++i) {
+    if (i != 50) {
+      EXPECT_EQ(dict[Dim("dim" + std::to_string(i))], i);
+    }
+  }
+  EXPECT_EQ(dict.begin()->first, Dim("dim1"));
+}
+
+TEST(Dict, large_dict_erase_below_threshold) {
+  auto dict = make_large_dict(20);
+  for (int i = 0; i < 18; ++i)
+    dict.erase(Dim("dim" + std::to_string(i)));
+  EXPECT_EQ(dict.size(), 2);
+  EXPECT_EQ(dict[Dim("dim18")], 18);
+  EXPECT_EQ(dict[Dim("dim19")], 19);
+  dict.insert_or_assign(Dim("dim0"), 0);
+  EXPECT_EQ(dict[Dim("dim0")], 0);
+}
+
+TEST(Dict, large_dict_clear_and_reuse) {
+  auto dict = make_large_dict(100);
+  dict.clear();
+  EXPECT_FALSE(dict.contains(Dim("dim1")));
+  dict.insert_or_assign(Dim("dim1"), 11);
+  EXPECT_EQ(dict[Dim("dim1")], 11);
+}
+
+TEST(Dict, large_dict_copy_has_independent_index) {
+  auto dict = make_large_dict(100);
+  auto copy(dict);
+  dict.erase(Dim("dim0"));
+  EXPECT_TRUE(copy.contains(Dim("dim0")));
+  EXPECT_EQ(copy[Dim("dim99")], 99);
+  EXPECT_EQ(dict[Dim("dim99")], 99);
+}
+
+TEST(Dict, large_dict_initializer_rejects_duplicates) {
+  EXPECT_THROW(
+      (DimDict{{Dim("a0"), 0},  {Dim("a1"), 1},  {Dim("a2"), 2},
+               {Dim("a3"), 3},  {Dim("a4"), 4},  {Dim("a5"), 5},
+               {Dim("a6"), 6},  {Dim("a7"), 7},  {Dim("a8"), 8},
+               {Dim("a9"), 9},  {Dim("a10"), 1}, {Dim("a11"), 1},
+               {Dim("a12"), 1}, {Dim("a13"), 1}, {Dim("a14"), 1},
+               {Dim("a15"), 1}, {Dim("a16"), 1}, {Dim("a17"), 1},
+               {Dim("a18"), 1}, {Dim("a0"), 1}}),
+      std::invalid_argument);
+}
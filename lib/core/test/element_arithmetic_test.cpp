@@ -58,6 +58,48 @@ TEST_F(ElementArithmeticTest, non_in_place) {
 
 TEST_F(ElementArithmeticTest, negative) { EXPECT_EQ(negative(a), -a); }
 
+TEST(ElementArithmeticReduceTest, add_equals_reduce) {
+  // Size is not a multiple of the number of partial sums.
+  std::vector<double> in(1001);
+  for (size_t i = 0; i < in.size(); ++i)
+    in[i] = 0.1 * static_cast<double>(i);
+  double expected = 1.5;
+  for (const auto x : in)
+    expected += x;
+  double out = 1.5;
+  add_equals.reduce(&out, in.data(), scipp::size(in));
+  EXPECT_DOUBLE_EQ(out, expected);
+  out = 1.5;
+  add_equals.reduce(&out, in.data(), 0);
+  EXPECT_EQ(out, 1.5);
+}
+
+TEST(ElementArithmeticReduceTest, add_equals_reduce_variances) {
+  const std::vector<double> values{1.0, 2.0, 3.0, 4.0, 5.0};
+  const std::vector<double> variances{0.5, 1.5, 2.5, 3.5, 4.5};
+  double out = 1.0;
+  double out_variance = 2.0;
+  add_equals.reduce(&out, &out_variance, values.data(), variances.data(),
+                    scipp::size(values));
+  EXPECT_EQ(out, 16.0);
+  EXPECT_EQ(out_variance, 14.5);
+  // Inputs without variances leave the output variance unchanged.
+  add_equals.reduce(&out, &out_variance, values.data(), scipp::size(values));
+  EXPECT_EQ(out, 31.0);
+  EXPECT_EQ(out_variance, 14.5);
+}
+
+TEST(ElementArithmeticReduceTest, add_equals_reduce_mixed_types) {
+  const std::vector<int32_t> in{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  int64_t out = 10;
+  add_equals.reduce(&out, in.data(), scipp::size(in));
+  EXPECT_EQ(out, 76);
+  const std::vector<float> in_float{0.5f, 1.5f, 2.5f};
+  double out_double = 0.0;
+  add_equals.reduce(&out_double, in_float.data(), scipp::size(in_float));
+  EXPECT_EQ(out_double, 4.5);
+}
+
 TEST(ElementArithmeticIntegerDivisionTest, truediv_32bit) {
   const int32_t a = 2;
   const int32_t b = 3;
@@ -2,13 +2,18 @@
 // Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <string>
 #include <vector>
 
 #include "scipp/core/element_array.h"
 
 using scipp::core::element_array;
 using scipp::core::init_for_overwrite;
+using scipp::core::large_allocation_config;
+using scipp::core::LargeAllocationConfig;
 
 static auto make_element_array() {
   std::vector<double> v{1.1, 2.2, 3.3};
@@ -180,3 +185,60 @@ TEST(ElementArrayTest, resize_default_init) {
   x.resize(0, init_for_overwrite);
   check_empty_element_array(x);
 }
+
+TEST(ElementArrayTest, construct_large) {
+  // Large enough for pages to be touched in parallel before filling.
+  const scipp::index size = 3 * 1024 * 1024 + 17;
+  element_array<double> x(size, 1.5);
+  ASSERT_EQ(x.size(), size);
+  EXPECT_TRUE(std::all_of(x.begin(), x.end(), [](auto v) { return v == 1.5; }));
+}
+
+TEST(ElementArrayTest, resize_default_init_large) {
+  const scipp::index size = 3 * 1024 * 1024 + 17;
+  element_array<char> x;
+  x.resize(size, init_for_overwrite);
+  ASSERT_EQ(x.size(), size);
+  std::fill(x.begin(), x.end(), 'a');
+  EXPECT_EQ(std::count(x.begin(), x.end(), 'a'), size);
+}
+
+class ElementArrayHugePagesTest : public ::testing::Test {
+protected:
+  ElementArrayHugePagesTest() : m_config(large_allocation_config()) {}
+  ~ElementArrayHugePagesTest() override {
+    large_allocation_config() = m_config;
+  }
+
+private:
+  LargeAllocationConfig m_config;
+};
+
+TEST_F(ElementArrayHugePagesTest, above_threshold) {
+  large_allocation_config().huge_page_threshold = 1024;
+  element_array<double> x(1000, 1.5);
+  ASSERT_EQ(x.size(), 1000);
+#ifdef __linux__
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(x.data()) % (2 * 1024 * 1024),
+            0);
+#endif
+  EXPECT_TRUE(std::all_of(x.begin(), x.end(), [](auto v) { return v == 1.5; }));
+  const auto copy(x);
+  EXPECT_TRUE(std::equal(x.begin(), x.end(), copy.begin(), copy.end()));
+  x.resize(10, init_for_overwrite);
+  EXPECT_EQ(x.size(), 10);
+}
+
+TEST_F(ElementArrayHugePagesTest, disabled) {
+  large_allocation_config().huge_page_threshold = -1;
+  large_allocation_config().prefault = false;
+  element_array<double> x(3 * 1024 * 1024, 1.5);
+  EXPECT_TRUE(std::all_of(x.begin(), x.end(), [](auto v) { return v == 1.5; }));
+}
+
+TEST_F(ElementArrayHugePagesTest, non_trivial_type_is_not_affected) {
+  large_allocation_config().huge_page_threshold = 0;
+  element_array<std::string> x(10, "abc");
+  EXPECT_TRUE(
+      std::all_of(x.begin(), x.end(), [](auto &v) { return v == "abc"; }));
+}
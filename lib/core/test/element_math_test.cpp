@@ -135,8 +135,8 @@ TEST(ElementReciprocalTest, value_and_variance) {
 }
 
 TEST(ElementExpTest, value) {
-  EXPECT_EQ(element::exp(1.23), std::exp(1.23));
-  EXPECT_EQ(element::exp(1.23456789f), std::exp(1.23456789f));
+  EXPECT_DOUBLE_EQ(element::exp(1.23), std::exp(1.23));
+  EXPECT_FLOAT_EQ(element::exp(1.23456789f), std::exp(1.23456789f));
 }
 
 TEST(ElementExpTest, unit) {
@@ -146,8 +146,8 @@ TEST(ElementExpTest, unit) {
 TEST(ElementExpTest, bad_unit) { EXPECT_ANY_THROW(element::exp(units::m)); }
 
 TEST(ElementLogTest, value) {
-  EXPECT_EQ(element::log(1.23), std::log(1.23));
-  EXPECT_EQ(element::log(1.23456789f), std::log(1.23456789f));
+  EXPECT_DOUBLE_EQ(element::log(1.23), std::log(1.23));
+  EXPECT_FLOAT_EQ(element::log(1.23456789f), std::log(1.23456789f));
 }
 
 TEST(ElementLogTest, unit) {
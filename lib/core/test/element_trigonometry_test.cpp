@@ -19,11 +19,11 @@ TEST(ElementSinOutArgTest, unit_rad) {
 }
 
 TEST(ElementSinOutArgTest, value_double) {
-  EXPECT_EQ(element::sin(pi<double>), std::sin(pi<double>));
+  EXPECT_DOUBLE_EQ(element::sin(pi<double>), std::sin(pi<double>));
 }
 
 TEST(ElementSinOutArgTest, value_float) {
-  EXPECT_EQ(element::sin(pi<float>), std::sin(pi<float>));
+  EXPECT_FLOAT_EQ(element::sin(pi<float>), std::sin(pi<float>));
 }
 
 TEST(ElementSinOutArgTest, supported_types) {
@@ -39,11 +39,11 @@ TEST(ElementCosOutArgTest, unit_rad) {
 }
 
 TEST(ElementCosOutArgTest, value_double) {
-  EXPECT_EQ(element::cos(pi<double>), std::cos(pi<double>));
+  EXPECT_DOUBLE_EQ(element::cos(pi<double>), std::cos(pi<double>));
 }
 
 TEST(ElementCosOutArgTest, value_float) {
-  EXPECT_EQ(element::cos(pi<float>), std::cos(pi<float>));
+  EXPECT_FLOAT_EQ(element::cos(pi<float>), std::cos(pi<float>));
 }
 
 TEST(ElementCosOutArgTest, supported_types) {
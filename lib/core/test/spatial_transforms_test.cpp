@@ -79,3 +79,23 @@ TEST(SpatialTransformsTest, combine_rotations) {
 
   ASSERT_TRUE(result.quat().isApprox(expected.quat(), TOLERANCE));
 }
+
+TEST(SpatialTransformsTest, linear_and_translation) {
+  Eigen::Quaterniond rotation;
+  rotation = Eigen::AngleAxisd(0.5, Eigen::Vector3d::UnitX());
+  const scipp::core::Quaternion quat(rotation);
+  const scipp::core::Translation translation(Eigen::Vector3d(4, 5, 6));
+  const Eigen::Affine3d affine = quat * translation;
+  const Eigen::Vector3d vec(1, 2, 3);
+
+  const auto apply = [&vec](const auto &transform) {
+    const auto [linear, offset] =
+        scipp::core::linear_and_translation(transform);
+    return Eigen::Vector3d(linear * vec + offset);
+  };
+  ASSERT_TRUE(apply(quat).isApprox(quat * vec, TOLERANCE));
+  ASSERT_TRUE(apply(translation).isApprox(translation * vec, TOLERANCE));
+  ASSERT_TRUE(apply(affine).isApprox(affine * vec, TOLERANCE));
+  ASSERT_TRUE(apply(affine.linear().eval()).isApprox(affine.linear() * vec,
+                                                     TOLERANCE));
+}
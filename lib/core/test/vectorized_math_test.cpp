@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "scipp/core/vectorized_math.h"
+
+using namespace scipp;
+namespace vm = scipp::core::vectorized_math;
+
+namespace {
+/// Error of `result` relative to the exact value `ref` in units in the last
+/// place of `result`.
+template <class T> double ulp_error(const T result, const long double ref) {
+  const auto ulp = std::nextafter(std::abs(result),
+                                  std::numeric_limits<T>::infinity()) -
+                   std::abs(result);
+  return static_cast<double>(std::abs(result - ref) / ulp);
+}
+
+std::vector<double> uniform(const double lo, const double hi) {
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<double> dist(lo, hi);
+  std::vector<double> x(100000);
+  for (auto &e : x)
+    e = dist(gen);
+  return x;
+}
+
+/// Values spanning the full range of positive doubles.
+std::vector<double> log_uniform() {
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<double> dist(-1022.0, 1023.0);
+  std::vector<double> x(100000);
+  for (auto &e : x)
+    e = std::exp2(dist(gen));
+  return x;
+}
+
+template <class T, class Ref>
+double max_ulp_error(const std::vector<double> &x, T (*f)(T), Ref ref) {
+  double max_error = 0.0;
+  for (const auto e : x) {
+    const auto in = static_cast<T>(e);
+    max_error = std::max(max_error, ulp_error(f(in), ref(in)));
+  }
+  return max_error;
+}
+
+template <class T>
+void expect_scalar_equals_array(const std::vector<double> &x, T (*f)(T),
+                                void (*f_array)(const T *, T *,
+                                                scipp::index)) {
+  const std::vector<T> in(x.begin(), x.end());
+  std::vector<T> out(in.size());
+  f_array(in.data(), out.data(), scipp::size(in));
+  for (size_t i = 0; i < in.size(); ++i)
+    if (std::isnan(f(in[i])))
+      EXPECT_TRUE(std::isnan(out[i]));
+    else
+      EXPECT_EQ(out[i], f(in[i])) << "x = " << in[i];
+}
+
+constexpr auto inf = std::numeric_limits<double>::infinity();
+constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+constexpr auto dmin = std::numeric_limits<double>::min();
+constexpr auto dmax = std::numeric_limits<double>::max();
+constexpr auto denorm = std::numeric_limits<double>::denorm_min();
+
+/// Inputs at and beyond the boundaries of the fast domains.
+const std::vector<double> special_values{
+    0.0,    -0.0,   inf,    -inf,   nan,  denorm, -denorm, dmin,
+    -dmin,  dmax,   -dmax,  1.0,    -1.0, 707.0,  -707.0,  709.0,
+    709.5,  710.0,  -708.0, -745.0, -746.0, 0x1p19, -0x1p19, 0x1p19 + 1,
+    1e300,  -1e300, 1e-300, 1e-310, 1e22, 0.5,    2.0,     1.5707963267948966};
+
+/// Check that inputs outside the fast domain give the standard library result.
+template <class T>
+void expect_special_values(T (*f)(T), T (*std_f)(T),
+                           void (*f_array)(const T *, T *, scipp::index)) {
+  const std::vector<T> in(special_values.begin(), special_values.end());
+  std::vector<T> out(in.size());
+  f_array(in.data(), out.data(), scipp::size(in));
+  for (size_t i = 0; i < in.size(); ++i) {
+    const auto expected = std_f(in[i]);
+    if (std::isnan(expected)) {
+      EXPECT_TRUE(std::isnan(f(in[i])));
+      EXPECT_TRUE(std::isnan(out[i]));
+    } else {
+      if (std::isinf(expected))
+        EXPECT_EQ(f(in[i]), expected);
+      else
+        EXPECT_NEAR(f(in[i]), expected,
+                    std::abs(expected) * std::numeric_limits<T>::epsilon())
+            << "x = " << in[i];
+      EXPECT_EQ(out[i], f(in[i])) << "x = " << in[i];
+    }
+  }
+}
+
+template <class T> T std_exp(const T x) { return std::exp(x); }
+template <class T> T std_log(const T x) { return std::log(x); }
+template <class T> T std_sin(const T x) { return std::sin(x); }
+template <class T> T std_cos(const T x) { return std::cos(x); }
+} // namespace
+
+TEST(VectorizedMathTest, exp_ulp_error) {
+  const auto ref = [](const long double x) { return std::exp(x); };
+  EXPECT_LT(max_ulp_error<double>(uniform(-707.0, 709.0), vm::exp, ref), 1.0);
+  EXPECT_LT(max_ulp_error<double>(uniform(-1.0, 1.0), vm::exp, ref), 1.0);
+  EXPECT_LT(max_ulp_error<float>(uniform(-87.0, 88.0), vm::exp, ref), 0.51);
+}
+
+TEST(VectorizedMathTest, log_ulp_error) {
+  const auto ref = [](const long double x) { return std::log(x); };
+  EXPECT_LT(max_ulp_error<double>(log_uniform(), vm::log, ref), 1.0);
+  EXPECT_LT(max_ulp_error<double>(uniform(0.5, 2.0), vm::log, ref), 1.0);
+  EXPECT_LT(max_ulp_error<float>(uniform(1e-30, 1e30), vm::log, ref), 0.51);
+}
+
+TEST(VectorizedMathTest, sin_ulp_error) {
+  const auto ref = [](const long double x) { return std::sin(x); };
+  EXPECT_LT(max_ulp_error<double>(uniform(-10.0, 10.0), vm::sin, ref), 1.0);
+  EXPECT_LT(max_ulp_error<double>(uniform(-0x1p19, 0x1p19), vm::sin, ref),
+            1.0);
+  EXPECT_LT(max_ulp_error<float>(uniform(-10.0, 10.0), vm::sin, ref), 0.51);
+}
+
+TEST(VectorizedMathTest, cos_ulp_error) {
+  const auto ref = [](const long double x) { return std::cos(x); };
+  EXPECT_LT(max_ulp_error<double>(uniform(-10.0, 10.0), vm::cos, ref), 1.0);
+  EXPECT_LT(max_ulp_error<double>(uniform(-0x1p19, 0x1p19), vm::cos, ref),
+            1.0);
+  EXPECT_LT(max_ulp_error<float>(uniform(-10.0, 10.0), vm::cos, ref), 0.51);
+}
+
+TEST(VectorizedMathTest, exp_special_values) {
+  expect_special_values<double>(vm::exp, std_exp, vm::exp);
+  expect_special_values<float>(vm::exp, std_exp, vm::exp);
+}
+
+TEST(VectorizedMathTest, log_special_values) {
+  expect_special_values<double>(vm::log, std_log, vm::log);
+  expect_special_values<float>(vm::log, std_log, vm::log);
+}
+
+TEST(VectorizedMathTest, sin_special_values) {
+  expect_special_values<double>(vm::sin, std_sin, vm::sin);
+  expect_special_values<float>(vm::sin, std_sin, vm::sin);
+  EXPECT_TRUE(std::signbit(vm::sin(-0.0)));
+}
+
+TEST(VectorizedMathTest, cos_special_values) {
+  expect_special_values<double>(vm::cos, std_cos, vm::cos);
+  expect_special_values<float>(vm::cos, std_cos, vm::cos);
+}
+
+TEST(VectorizedMathTest, scalar_equals_array) {
+  // Size is not a multiple of the internal block size.
+  auto x = uniform(-20.0, 20.0);
+  x.resize(1000);
+  x.insert(x.begin() + 300, special_values.begin(), special_values.end());
+  expect_scalar_equals_array<double>(x, vm::exp, vm::exp);
+  expect_scalar_equals_array<double>(x, vm::log, vm::log);
+  expect_scalar_equals_array<double>(x, vm::sin, vm::sin);
+  expect_scalar_equals_array<double>(x, vm::cos, vm::cos);
+  expect_scalar_equals_array<float>(x, vm::exp, vm::exp);
+  expect_scalar_equals_array<float>(x, vm::log, vm::log);
+  expect_scalar_equals_array<float>(x, vm::sin, vm::sin);
+  expect_scalar_equals_array<float>(x, vm::cos, vm::cos);
+}
+
+TEST(VectorizedMathTest, array_in_place) {
+  const auto x = uniform(-20.0, 20.0);
+  auto y = x;
+  vm::sin(y.data(), y.data(), scipp::size(y));
+  for (size_t i = 0; i < x.size(); ++i)
+    EXPECT_EQ(y[i], vm::sin(x[i]));
+}
@@ -64,12 +64,14 @@ auto setup_and_apply(const Variable &data, const Variable &indices,
   subbin_sizes_add_intersection(
       offsets, cumsum_exclusive_subbin_sizes(output_bin_sizes));
   Variable filtered_input_bin_size = sum_subbin_sizes(output_bin_sizes);
-  auto end = cumsum(filtered_input_bin_size);
+  const auto end = cumsum(filtered_input_bin_size);
   const auto total_size =
       end.dims().volume() > 0 ? end.values<scipp::index>().as_span().back() : 0;
-  end = broadcast(end, data.dims()); // required for some cases of rebinning
+  const auto begin = end - filtered_input_bin_size;
+  // Broadcast required for some cases of rebinning. Only the output of zip
+  // is allocated with the full data dims.
   const auto filtered_input_bin_ranges =
-      zip(end - filtered_input_bin_size, end);
+      zip(broadcast(begin, data.dims()), broadcast(end, data.dims()));
 
   // Perform actual binning step for data, all coords, all masks, ...
   const auto do_bin = [&](const auto &var) {
@@ -186,7 +188,7 @@ public:
       if (action == AxisAction::Group)
         update_indices_by_grouping(indices, get_coord(dim), key);
       else if (action == AxisAction::Bin) {
-        const auto linspace = all(islinspace(key, dim)).template value<bool>();
+        const auto linspace = alllinspace(key, dim);
         // When binning along an existing dim with a coord (may be edges or
         // not), not all input bins can map to all output bins. The array of
         // subbin sizes that is normally created thus contains mainly zero
@@ -3,12 +3,14 @@
 /// @file
 /// @author Simon Heybrock
 #include <algorithm>
+#include <atomic>
 #include <limits>
 
 #include "scipp/core/bucket.h"
 #include "scipp/core/element/event_operations.h"
 #include "scipp/core/element/histogram.h"
 #include "scipp/core/except.h"
+#include "scipp/core/parallel.h"
 
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/bins.h"
@@ -20,6 +22,7 @@
 #include "scipp/variable/transform_subspan.h"
 #include "scipp/variable/util.h"
 #include "scipp/variable/variable.h"
+#include "scipp/variable/variable_concept.h"
 #include "scipp/variable/variable_factory.h"
 
 #include "scipp/dataset/bins.h"
@@ -30,6 +33,7 @@
 #include "../variable/operations_common.h"
 #include "bin_common.h"
 #include "bin_detail.h"
+#include "bins_util.h"
 #include "dataset_operations_common.h"
 
 namespace scipp::dataset {
@@ -233,6 +237,53 @@ Variable pretend_bins_for_threading(const DataArray &da, Dim bin_dim) {
 namespace scipp::dataset::buckets {
 namespace {
 
+/// Return `f(T{})` if `coord` is a contiguous 1-D variable without variances
+/// with an ordered dtype T, or false otherwise.
+template <class F> bool visit_sortable(const Variable &coord, F f) {
+  if (coord.ndim() != 1 || coord.stride(coord.dim()) != 1 ||
+      coord.has_variances())
+    return false;
+  const auto type = coord.dtype();
+  if (type == dtype<double>)
+    return f(double{});
+  if (type == dtype<float>)
+    return f(float{});
+  if (type == dtype<int64_t>)
+    return f(int64_t{});
+  if (type == dtype<int32_t>)
+    return f(int32_t{});
+  if (type == dtype<core::time_point>)
+    return f(core::time_point{});
+  return false;
+}
+
+/// Call `f(bin)` for every element of `bins`, in parallel.
+template <class F>
+void for_each_bin(const scipp::span<scipp::index_pair> bins, F f) {
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, scipp::size(bins)),
+      [&](const auto &range) {
+        for (auto i = range.begin(); i < range.end(); ++i)
+          f(bins[i]);
+      });
+}
+
+bool compute_is_sorted_by(const Variable &indices, const Variable &coord) {
+  return visit_sortable(coord, [&](const auto tag) {
+    using T = std::decay_t<decltype(tag)>;
+    const auto values = coord.values<T>().as_span();
+    auto bins = copy(indices);
+    std::atomic<bool> sorted{true};
+    for_each_bin(bins.values<scipp::index_pair>().as_span(),
+                 [&](const auto &bin) {
+                   if (sorted && !std::is_sorted(values.begin() + bin.first,
+                                                 values.begin() + bin.second))
+                     sorted = false;
+                 });
+    return sorted.load();
+  });
+}
+
 template <class T> auto combine(const Variable &var0, const Variable &var1) {
   const auto &[indices0, dim0, buffer0] = var0.constituents<T>();
   const auto &[indices1, dim1, buffer1] = var1.constituents<T>();
@@ -343,11 +394,10 @@ Variable histogram(const Variable &data, const Variable &binEdges) {
   }
 
   const auto masked = masked_data(buffer, dim);
-  auto hist = variable::transform_subspan(
-      buffer.dtype(), hist_dim, nbin,
+  auto hist = histogram_subspans(
+      buffer.dtype(), hist_dim,
       subspan_view(buffer.meta()[hist_dim], dim, indices),
-      subspan_view(masked, dim, indices), binEdges, element::histogram,
-      "histogram");
+      subspan_view(masked, dim, indices), binEdges);
   if (hist.dims().contains(dummy))
     return sum(hist, dummy);
   else
@@ -365,7 +415,7 @@ Variable map(const DataArray &function, const Variable &x, Dim dim,
         "Function used as lookup table in map operation must be a histogram");
   const auto data = masked_data(function, dim, fill);
   const auto weights = subspan_view(data, dim);
-  if (all(islinspace(edges, dim)).value<bool>()) {
+  if (alllinspace(edges, dim)) {
     return variable::transform(x, subspan_view(edges, dim), weights, fill,
                                core::element::event::map_linspace, "map");
   } else {
@@ -388,7 +438,7 @@ void scale(DataArray &array, const DataArray &histogram, Dim dim) {
   const auto &edges = histogram.meta()[dim];
   const auto masked = masked_data(histogram, dim);
   const auto weights = subspan_view(masked, dim);
-  if (all(islinspace(edges, dim)).value<bool>()) {
+  if (alllinspace(edges, dim)) {
     transform_in_place(data, coord, subspan_view(edges, dim), weights,
                        core::element::event::map_and_mul_linspace,
                        "bins.scale");
@@ -400,4 +450,68 @@ void scale(DataArray &array, const DataArray &histogram, Dim dim) {
                        "bins.scale");
   }
 }
+
+/// Return true if the events in all bins of `var` are sorted by coord `dim`.
+///
+/// Only contiguous coords without variances are considered sorted. The result
+/// is cached with the data of the coord and reused until the coord or the bin
+/// indices are modified.
+bool is_sorted_by(const Variable &var, const Dim dim) {
+  const auto &[indices, buffer_dim, buffer] = var.constituents<DataArray>();
+  const auto &coord = buffer.coords()[dim];
+  if (coord.is_slice())
+    return compute_is_sorted_by(indices, coord);
+  auto &cache = coord.data().property_cache();
+  // The result depends on the indices, so it is keyed by the generation of
+  // their data, which changes whenever the indices may be modified.
+  const auto context = indices.data().property_cache().generation();
+  const auto property = variable::CachedProperty::SortedWithinBins;
+  if (const auto value = cache.get(indices, property, buffer_dim, context))
+    return *value;
+  const auto generation = cache.generation();
+  const bool value = compute_is_sorted_by(indices, coord);
+  cache.set(indices, property, buffer_dim, value, generation, context);
+  return value;
+}
+
+/// Return a view of the events in the bins of `var` with `begin <= coord <
+/// end`, where coord is the event coord `dim`.
+///
+/// The events in all bins must be sorted by `dim`, see `is_sorted_by`. The
+/// bounds of every bin are found by binary search and the output shares the
+/// buffer of `var`.
+Variable slice_sorted(const Variable &var, const Dim dim,
+                      const Variable &begin, const Variable &end) {
+  const auto &[indices, buffer_dim, buffer] = var.constituents<DataArray>();
+  const auto &coord = buffer.coords()[dim];
+  for (const auto &bound : {begin, end}) {
+    core::expect::ndim_is(bound.dims(), 0);
+    core::expect::equals(coord.unit(), bound.unit());
+    if (bound.dtype() != coord.dtype())
+      throw except::TypeError("Bounds of dtype " + to_string(bound.dtype()) +
+                              " cannot be used with coord of dtype " +
+                              to_string(coord.dtype()) + ".");
+    if (bound.has_variances())
+      throw except::VariancesError("Bounds must not have variances.");
+  }
+  if (!is_sorted_by(var, dim))
+    throw except::BinnedDataError("Events must be sorted by '" +
+                                  to_string(dim) + "' within every bin.");
+  auto out = copy(indices);
+  visit_sortable(coord, [&](const auto tag) {
+    using T = std::decay_t<decltype(tag)>;
+    const auto values = coord.values<T>().as_span();
+    const auto lo = begin.value<T>();
+    const auto hi = end.value<T>();
+    for_each_bin(out.values<scipp::index_pair>().as_span(), [&](auto &bin) {
+      const auto first = values.begin() + bin.first;
+      const auto last = values.begin() + bin.second;
+      const auto lower = std::lower_bound(first, last, lo);
+      const auto upper = std::max(lower, std::lower_bound(first, last, hi));
+      bin = {lower - values.begin(), upper - values.begin()};
+    });
+    return true;
+  });
+  return make_bins_no_validate(std::move(out), buffer_dim, buffer);
+}
 } // namespace scipp::dataset::buckets
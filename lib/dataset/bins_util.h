@@ -4,8 +4,12 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include "scipp/core/element/histogram.h"
 #include "scipp/dataset/bins.h"
+#include "scipp/dataset/except.h"
 #include "scipp/variable/shape.h"
+#include "scipp/variable/to_unit.h"
+#include "scipp/variable/transform_subspan.h"
 #include "scipp/variable/util.h"
 
 namespace scipp::dataset {
@@ -27,4 +31,51 @@ Variable hide_masked(const Variable &data, const Masks &masks,
   return make_bins_no_validate(indices, buffer_dim, buffer);
 }
 
+inline bool is_floating_point_subspan(const Variable &var) {
+  const auto type = var.dtype();
+  return type == dtype<scipp::span<const double>> ||
+         type == dtype<scipp::span<double>> ||
+         type == dtype<scipp::span<const float>> ||
+         type == dtype<scipp::span<float>>;
+}
+
+/// Histogram `coord` and `data`, both subspan views, into `binEdges`.
+///
+/// If all histograms share the same 1-D edges, the edges are checked only
+/// once, instead of once per histogram in the kernel. The result of the check
+/// is cached with the edges, so repeated histogramming skips it entirely.
+///
+/// If a floating-point `coord` has a unit different from but convertible to
+/// the unit of `binEdges`, the conversion is applied on the fly in the kernel,
+/// instead of histogramming a converted copy of the coord.
+inline Variable histogram_subspans(const DType type, const Dim dim,
+                                   const Variable &coord,
+                                   const Variable &data,
+                                   const Variable &binEdges) {
+  const auto nbin = binEdges.dims()[dim] - 1;
+  const bool convert = coord.unit() != binEdges.unit() &&
+                       coord.unit().has_same_base(binEdges.unit()) &&
+                       is_floating_point_subspan(coord);
+  const auto scale =
+      convert ? variable::to_unit_scale(coord.unit(), binEdges.unit()) : 1.0;
+  const auto hist = [&](const auto &fill) {
+    using namespace core::element::histogram_detail;
+    if (convert)
+      return variable::transform_subspan(type, dim, nbin, coord, data,
+                                         binEdges,
+                                         make_scaled_histogram(fill, scale),
+                                         "histogram");
+    return variable::transform_subspan(type, dim, nbin, coord, data, binEdges,
+                                       make_histogram(fill), "histogram");
+  };
+  using namespace core::element::histogram_detail;
+  if (binEdges.ndim() != 1)
+    return hist(fill_checked);
+  if (alllinspace(binEdges, dim))
+    return hist(fill_linspace);
+  if (!allsorted(binEdges, dim))
+    throw except::BinEdgeError("Bin edges of histogram must be sorted.");
+  return hist(fill_sorted_edges);
+}
+
 } // namespace scipp::dataset
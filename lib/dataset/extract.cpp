@@ -2,8 +2,10 @@
 // Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <algorithm>
 #include <numeric>
 
+#include "scipp/core/parallel.h"
 #include "scipp/variable/variable_factory.h"
 
 #include "scipp/dataset/bins.h"
@@ -11,6 +13,8 @@
 #include "scipp/dataset/extract.h"
 #include "scipp/dataset/util.h"
 
+#include "sort_detail.h"
+
 namespace scipp {
 
 namespace {
@@ -86,6 +90,45 @@ T extract_ranges(const Variable &indices, const T &data, const Dim dim) {
 }
 
 namespace {
+/// Return the indices of the elements of `values` that are true.
+///
+/// This is a stream compaction in three steps: The selected elements of each
+/// block are counted, an exclusive scan over the counts yields the output
+/// offset of each block, and finally the indices are written by each block.
+/// The counting and writing is done in parallel over blocks, and the write is
+/// branch-free such that it can be vectorized.
+std::vector<scipp::index> nonzero(const scipp::span<const bool> values) {
+  constexpr scipp::index block_size = 65536;
+  const auto size = scipp::size(values);
+  const auto n_block = (size + block_size - 1) / block_size;
+  const auto for_each_block = [&](const auto &op) {
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, n_block), [&](const auto &range) {
+          for (auto block = range.begin(); block != range.end(); ++block)
+            op(block, block * block_size,
+               std::min(size, (block + 1) * block_size));
+        });
+  };
+  std::vector<scipp::index> offsets(n_block + 1, 0);
+  for_each_block([&](const auto block, const auto begin, const auto end) {
+    offsets[block + 1] =
+        std::count(values.begin() + begin, values.begin() + end, true);
+  });
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  // One element of slack for the unconditional store past the last selected
+  // element.
+  std::vector<scipp::index> indices(offsets.back() + 1);
+  for_each_block([&](const auto block, const auto begin, const auto end) {
+    auto *out = indices.data() + offsets[block];
+    for (auto i = begin; i < end; ++i) {
+      *out = i;
+      out += values[i];
+    }
+  });
+  indices.pop_back();
+  return indices;
+}
+
 template <class T> T extract_impl(const T &obj, const Variable &condition) {
   if (condition.dtype() != dtype<bool>)
     throw except::TypeError(
@@ -101,20 +144,8 @@ template <class T> T extract_impl(const T &obj, const Variable &condition) {
         " must be be included in the dimensions of the sliced object " +
         to_string(obj.dims()) + '.');
 
-  auto values = condition.values<bool>().as_span();
-  std::vector<scipp::index_pair> indices;
-  for (scipp::index i = 0; i < scipp::size(values); ++i) {
-    if (i > 0 && values[i - 1] == values[i])
-      continue;    // not an edge
-    if (values[i]) // rising edge
-      indices.emplace_back(i, scipp::size(values));
-    else if (i != 0) // falling edge
-      indices.back().second = i;
-  }
-  return extract_ranges(makeVariable<scipp::index_pair>(Dims{condition.dim()},
-                                                        Shape{indices.size()},
-                                                        Values(indices)),
-                        obj, condition.dim());
+  const auto indices = nonzero(condition.values<bool>().as_span());
+  return dataset::sort_detail::gather(obj, condition.dim(), indices);
 }
 } // namespace
 
@@ -26,6 +26,7 @@
 #include "../variable/operations_common.h"
 #include "bin_common.h"
 #include "dataset_operations_common.h"
+#include "sort_detail.h"
 
 using namespace scipp::variable;
 
@@ -63,7 +64,8 @@ T GroupBy<T>::makeReductionOutput(const Dim reductionDim,
     out = resize_array(m_data, reductionDim, size(), fill);
   }
   out = out.rename_dims({{reductionDim, dim()}});
-  out.coords().set(dim(), key());
+  for (const auto &[name, coord] : m_grouping.coords())
+    out.coords().set(name, coord);
   return out;
 }
 
@@ -112,6 +114,9 @@ T GroupBy<T>::reduce(Op op, const Dim reductionDim,
 ///
 /// This only supports binned data.
 template <class T> T GroupBy<T>::concat(const Dim reductionDim) const {
+  if (!key().is_valid())
+    throw except::NotImplementedError(
+        "groupby.concat does not support grouping by multiple keys yet.");
   const auto conc = [&](const auto &data) {
     if (key().dims().volume() == scipp::size(groups()))
       return groupby_concat_bins(data, {}, key(), reductionDim);
@@ -287,9 +292,10 @@ template <class T> struct MakeBinGroups {
       throw except::DimensionError("Group-by bins must be 1-dimensional");
     if (key.unit() != bins.unit())
       throw except::UnitError("Group-by key must have same unit as bins");
+    if (!allsorted(bins, bins.dim()))
+      throw except::BinEdgeError("Bin edges of histogram must be sorted.");
     const auto &values = key.values<T>();
     const auto &edges = bins.values<T>();
-    core::expect::histogram::sorted_edges(edges);
 
     const auto dim = key.dim();
     std::vector<GroupByGrouping::group> groups(edges.size() - 1);
@@ -311,6 +317,53 @@ template <class T> struct MakeBinGroups {
   }
 };
 
+/// Group by the unique combinations of values of multiple keys.
+///
+/// The groups are ordered lexicographically by the keys, with the first key
+/// being the most significant. Groups are found by sorting a composite key
+/// packed from all keys.
+GroupByGrouping make_multi_key_groups(const std::vector<Variable> &keys,
+                                      const std::vector<Dim> &names) {
+  for (const auto &key : keys)
+    expect::is_key(key);
+  sort_detail::expect_valid_keys(keys);
+  const auto dim = keys.front().dim();
+  const auto packed = sort_detail::pack_keys(keys);
+  const auto perm = sort_detail::argsort(packed);
+  std::vector<scipp::index> first;
+  std::vector<GroupByGrouping::group> groups;
+  for (size_t i = 0; i < perm.size(); ++i) {
+    const auto row = perm[i];
+    if (i == 0 || packed[row] != packed[perm[i - 1]]) {
+      groups.emplace_back();
+      first.emplace_back(row);
+    }
+    // The sort is stable, so rows within a group are ascending. Use contiguous
+    // (thick) slices if possible to avoid overhead of slice handling in
+    // follow-up "apply" steps.
+    auto &group = groups.back();
+    if (!group.empty() && group.back().end() == row)
+      group.back() = Slice(dim, group.back().begin(), row + 1);
+    else
+      group.emplace_back(dim, row, row + 1);
+  }
+  std::vector<std::pair<Dim, Variable>> coords;
+  for (size_t i = 0; i < keys.size(); ++i)
+    coords.emplace_back(names[i],
+                        sort_detail::gather(keys[i], dim, first)
+                            .rename_dims({{dim, Dim::Group}}));
+  return {dim, Dim::Group, std::move(coords), std::move(groups)};
+}
+
+template <class T>
+GroupBy<T> call_groupby(const T &array, const std::vector<Dim> &dims) {
+  std::vector<Variable> keys;
+  keys.reserve(dims.size());
+  for (const auto &dim : dims)
+    keys.emplace_back(array.meta()[dim]);
+  return {array, make_multi_key_groups(keys, dims)};
+}
+
 template <class T>
 GroupBy<T> call_groupby(const T &array, const Variable &key,
                         const Variable &bins) {
@@ -400,6 +453,27 @@ GroupBy<Dataset> groupby(const Dataset &dataset, const Variable &key,
   throw except::DimensionError("Size of Group-by key is incorrect.");
 }
 
+/// Create GroupBy<DataArray> object grouping by multiple coords.
+///
+/// Groups the slices of `array` according to the unique combinations of
+/// values of the given coords. In contrast to grouping by a single coord, the
+/// output dimension of a later apply/combine step is Dim::Group, with one
+/// coord for each of `dims`.
+GroupBy<DataArray> groupby(const DataArray &array,
+                           const std::vector<Dim> &dims) {
+  return call_groupby(array, dims);
+}
+
+/// Create GroupBy<Dataset> object grouping by multiple coords.
+///
+/// Groups the slices of `dataset` according to the unique combinations of
+/// values of the given coords. In contrast to grouping by a single coord, the
+/// output dimension of a later apply/combine step is Dim::Group, with one
+/// coord for each of `dims`.
+GroupBy<Dataset> groupby(const Dataset &dataset, const std::vector<Dim> &dims) {
+  return call_groupby(dataset, dims);
+}
+
 template class GroupBy<DataArray>;
 template class GroupBy<Dataset>;
 
@@ -77,11 +77,10 @@ DataArray histogram(const DataArray &events, const Variable &binEdges) {
             // This sums automatically over Dim::InternalHistogram
             return buckets::histogram(binned, binEdges_);
           }
-          return transform_subspan(events_.dtype(), dim,
-                                   binEdges_.dims()[dim] - 1,
-                                   subspan_view(cont_coord, event_dim_),
-                                   subspan_view(cont_data, event_dim_),
-                                   binEdges_, element::histogram, "histogram");
+          return histogram_subspans(events_.dtype(), dim,
+                                    subspan_view(cont_coord, event_dim_),
+                                    subspan_view(cont_data, event_dim_),
+                                    binEdges_);
         },
         event_dim, binEdges);
   } else {
@@ -70,4 +70,11 @@ map(const DataArray &function, const Variable &x, Dim dim,
 SCIPP_DATASET_EXPORT void scale(DataArray &data, const DataArray &histogram,
                                 Dim dim = Dim::Invalid);
 
+[[nodiscard]] SCIPP_DATASET_EXPORT bool is_sorted_by(const Variable &var,
+                                                     const Dim dim);
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable slice_sorted(const Variable &var,
+                                                         const Dim dim,
+                                                         const Variable &begin,
+                                                         const Variable &end);
+
 } // namespace scipp::dataset::buckets
@@ -19,18 +19,30 @@ class SCIPP_DATASET_EXPORT GroupByGrouping {
 public:
   using group = boost::container::small_vector<Slice, 4>;
   GroupByGrouping(const Dim sliceDim, Variable key, std::vector<group> groups)
-      : m_sliceDim(sliceDim), m_key(std::move(key)),
+      : m_sliceDim(sliceDim), m_dim(key.dims().inner()), m_key(key),
+        m_coords{{m_dim, std::move(key)}}, m_groups(std::move(groups)) {}
+  /// Grouping by multiple keys. There is no single key, instead the output
+  /// has one coord for each of the keys along `dim`.
+  GroupByGrouping(const Dim sliceDim, const Dim dim,
+                  std::vector<std::pair<Dim, Variable>> coords,
+                  std::vector<group> groups)
+      : m_sliceDim(sliceDim), m_dim(dim), m_coords(std::move(coords)),
         m_groups(std::move(groups)) {}
 
   scipp::index size() const noexcept { return scipp::size(m_groups); }
   Dim sliceDim() const noexcept { return m_sliceDim; }
-  Dim dim() const noexcept { return m_key.dims().inner(); }
+  Dim dim() const noexcept { return m_dim; }
   const Variable &key() const noexcept { return m_key; }
+  const std::vector<std::pair<Dim, Variable>> &coords() const noexcept {
+    return m_coords;
+  }
   const std::vector<group> &groups() const noexcept { return m_groups; }
 
 private:
   Dim m_sliceDim;
+  Dim m_dim;
   Variable m_key;
+  std::vector<std::pair<Dim, Variable>> m_coords;
   std::vector<group> m_groups;
 };
 
@@ -84,4 +96,9 @@ SCIPP_DATASET_EXPORT GroupBy<DataArray> groupby(const DataArray &dataset,
 SCIPP_DATASET_EXPORT GroupBy<Dataset>
 groupby(const Dataset &dataset, const Variable &variable, const Variable &bins);
 
+SCIPP_DATASET_EXPORT GroupBy<DataArray> groupby(const DataArray &array,
+                                                const std::vector<Dim> &dims);
+SCIPP_DATASET_EXPORT GroupBy<Dataset> groupby(const Dataset &dataset,
+                                              const std::vector<Dim> &dims);
+
 } // namespace scipp::dataset
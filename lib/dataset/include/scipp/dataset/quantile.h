@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include "scipp/dataset/dataset.h"
+
+namespace scipp::dataset {
+
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray
+quantile(const DataArray &a, const Dim dim, const double q);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray quantile(const DataArray &a,
+                                                      const double q);
+[[nodiscard]] SCIPP_DATASET_EXPORT Dataset quantile(const Dataset &d,
+                                                    const Dim dim,
+                                                    const double q);
+[[nodiscard]] SCIPP_DATASET_EXPORT Dataset quantile(const Dataset &d,
+                                                    const double q);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray
+nanquantile(const DataArray &a, const Dim dim, const double q);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray nanquantile(const DataArray &a,
+                                                         const double q);
+[[nodiscard]] SCIPP_DATASET_EXPORT Dataset nanquantile(const Dataset &d,
+                                                       const Dim dim,
+                                                       const double q);
+[[nodiscard]] SCIPP_DATASET_EXPORT Dataset nanquantile(const Dataset &d,
+                                                       const double q);
+
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray median(const DataArray &a,
+                                                    const Dim dim);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray median(const DataArray &a);
+[[nodiscard]] SCIPP_DATASET_EXPORT Dataset median(const Dataset &d,
+                                                  const Dim dim);
+[[nodiscard]] SCIPP_DATASET_EXPORT Dataset median(const Dataset &d);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray nanmedian(const DataArray &a,
+                                                       const Dim dim);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray nanmedian(const DataArray &a);
+[[nodiscard]] SCIPP_DATASET_EXPORT Dataset nanmedian(const Dataset &d,
+                                                     const Dim dim);
+[[nodiscard]] SCIPP_DATASET_EXPORT Dataset nanmedian(const Dataset &d);
+
+// Quantiles of all events within a bin.
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable bins_quantile(const Variable &data,
+                                                          const double q);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray bins_quantile(const DataArray &a,
+                                                           const double q);
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable
+bins_nanquantile(const Variable &data, const double q);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray
+bins_nanquantile(const DataArray &a, const double q);
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable bins_median(const Variable &data);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray bins_median(const DataArray &a);
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable
+bins_nanmedian(const Variable &data);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray bins_nanmedian(const DataArray &a);
+
+} // namespace scipp::dataset
@@ -155,13 +155,23 @@ protected:
 ///
 /// Irreducible means that a reduction operation must apply these masks since
 /// they depend on the reduction dimension. Returns an invalid (empty) variable
-/// if there is no irreducible mask.
+/// if there is no irreducible mask. If there is a single irreducible mask it is
+/// returned as a read-only view without making a copy.
 template <class Masks>
 [[nodiscard]] Variable irreducible_mask(const Masks &masks, const Dim dim) {
   Variable union_;
+  bool owned = false; // true if union_ is a new buffer that can be written to
   for (const auto &mask : masks)
-    if (mask.second.dims().contains(dim))
-      union_ = union_.is_valid() ? union_ | mask.second : copy(mask.second);
+    if (mask.second.dims().contains(dim)) {
+      if (!union_.is_valid()) {
+        union_ = mask.second.as_const();
+      } else if (owned && union_.dims().includes(mask.second.dims())) {
+        union_ |= mask.second;
+      } else {
+        union_ = union_ | mask.second;
+        owned = true;
+      }
+    }
   return union_;
 }
 
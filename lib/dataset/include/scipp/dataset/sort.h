@@ -4,6 +4,8 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include <vector>
+
 #include "scipp/core/flags.h"
 #include "scipp/dataset/dataset.h"
 #include "scipp/variable/variable.h"
@@ -24,4 +26,20 @@ SCIPP_DATASET_EXPORT Dataset sort(const Dataset &dataset, const Variable &key,
 SCIPP_DATASET_EXPORT Dataset sort(const Dataset &dataset, const Dim &key,
                                   const SortOrder order = SortOrder::Ascending);
 
+SCIPP_DATASET_EXPORT Variable
+sort(const Variable &var, const std::vector<Variable> &keys,
+     const SortOrder order = SortOrder::Ascending);
+SCIPP_DATASET_EXPORT DataArray
+sort(const DataArray &array, const std::vector<Variable> &keys,
+     const SortOrder order = SortOrder::Ascending);
+SCIPP_DATASET_EXPORT DataArray
+sort(const DataArray &array, const std::vector<Dim> &keys,
+     const SortOrder order = SortOrder::Ascending);
+SCIPP_DATASET_EXPORT Dataset
+sort(const Dataset &dataset, const std::vector<Variable> &keys,
+     const SortOrder order = SortOrder::Ascending);
+SCIPP_DATASET_EXPORT Dataset
+sort(const Dataset &dataset, const std::vector<Dim> &keys,
+     const SortOrder order = SortOrder::Ascending);
+
 } // namespace scipp::dataset
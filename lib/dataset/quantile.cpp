@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include "scipp/dataset/quantile.h"
+#include "scipp/core/except.h"
+#include "scipp/variable/logical.h"
+#include "scipp/variable/quantile.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/subspan_view.h"
+
+#include "dataset_operations_common.h"
+
+namespace scipp::dataset {
+
+namespace {
+DataArray quantile_(const DataArray &a, const Dim dim, const double q,
+                    const bool skip_nan) {
+  return apply_to_data_and_drop_dim(
+      a,
+      [&](const Variable &data, const Dim dim_) {
+        return variable::quantile_impl(data, dim_, q, skip_nan,
+                                       irreducible_mask(a.masks(), dim_));
+      },
+      dim);
+}
+
+/// Quantile along all dims. Masks that depend on any dim are applied, only
+/// scalar coords, masks, and attrs are kept.
+DataArray quantile_(const DataArray &a, const double q, const bool skip_nan) {
+  const auto flatten_all = [](const Variable &var) {
+    return flatten(var, var.dims().labels(), Dim::InternalAccumulate);
+  };
+  Variable mask;
+  for (const auto &[name, m] : a.masks())
+    if (m.dims().ndim() != 0)
+      mask = mask.is_valid() ? mask | m : m;
+  if (mask.is_valid())
+    mask = flatten_all(broadcast(mask, a.dims()));
+  auto data = variable::quantile_impl(flatten_all(a.data()),
+                                      Dim::InternalAccumulate, q, skip_nan,
+                                      mask);
+  const auto scalar = [](const Variable &var) {
+    return var.dims().ndim() == 0 ? var : Variable{};
+  };
+  const auto scalar_copy = [](const Variable &var) {
+    return var.dims().ndim() == 0 ? copy(var) : Variable{};
+  };
+  return DataArray(std::move(data),
+                   transform_map<Coords::holder_type>(a.coords(), scalar),
+                   transform_map<Masks::holder_type>(a.masks(), scalar_copy),
+                   transform_map<Attrs::holder_type>(a.attrs(), scalar),
+                   a.name());
+}
+
+/// Quantile of the events in each bin, ignoring masked events.
+Variable bins_quantile_(const Variable &data, const double q,
+                        const bool skip_nan) {
+  if (data.dtype() == dtype<bucket<DataArray>>) {
+    const auto &&[indices, dim, buffer] = data.constituents<DataArray>();
+    const auto mask = irreducible_mask(buffer.masks(), dim);
+    return variable::subspan_quantile(
+        subspan_view(buffer.data(), dim, indices),
+        mask.is_valid() ? subspan_view(mask, dim, indices) : Variable{}, q,
+        skip_nan);
+  }
+  if (data.dtype() == dtype<bucket<Variable>>) {
+    const auto &&[indices, dim, buffer] = data.constituents<Variable>();
+    return variable::subspan_quantile(subspan_view(buffer, dim, indices), {},
+                                      q, skip_nan);
+  }
+  throw except::TypeError("Expected binned data with buffer of type "
+                          "Variable or DataArray, got " +
+                          to_string(data.dtype()) + '.');
+}
+
+DataArray bins_quantile_(const DataArray &a, const double q,
+                         const bool skip_nan) {
+  return DataArray(bins_quantile_(a.data(), q, skip_nan), a.coords(),
+                   copy(a.masks()), a.attrs(), a.name());
+}
+} // namespace
+
+/// Return the `q`-quantile along given dimension, ignoring masked elements.
+///
+/// Linear interpolation between the closest ranks is used, i.e., the same
+/// method as the default of `numpy.quantile`. Each output element is computed
+/// using a selection algorithm, in parallel.
+DataArray quantile(const DataArray &a, const Dim dim, const double q) {
+  return quantile_(a, dim, q, false);
+}
+
+/// Return the `q`-quantile along all dimensions, ignoring masked elements.
+DataArray quantile(const DataArray &a, const double q) {
+  return quantile_(a, q, false);
+}
+
+Dataset quantile(const Dataset &d, const Dim dim, const double q) {
+  return apply_to_items(
+      d, [](auto &&..._) { return quantile(_...); }, dim, q);
+}
+
+Dataset quantile(const Dataset &d, const double q) {
+  return apply_to_items(
+      d, [](auto &&..._) { return quantile(_...); }, q);
+}
+
+/// Return the `q`-quantile along given dimension, ignoring masked elements
+/// and NaN values.
+DataArray nanquantile(const DataArray &a, const Dim dim, const double q) {
+  return quantile_(a, dim, q, true);
+}
+
+/// Return the `q`-quantile along all dimensions, ignoring masked elements and
+/// NaN values.
+DataArray nanquantile(const DataArray &a, const double q) {
+  return quantile_(a, q, true);
+}
+
+Dataset nanquantile(const Dataset &d, const Dim dim, const double q) {
+  return apply_to_items(
+      d, [](auto &&..._) { return nanquantile(_...); }, dim, q);
+}
+
+Dataset nanquantile(const Dataset &d, const double q) {
+  return apply_to_items(
+      d, [](auto &&..._) { return nanquantile(_...); }, q);
+}
+
+DataArray median(const DataArray &a, const Dim dim) {
+  return quantile(a, dim, 0.5);
+}
+
+DataArray median(const DataArray &a) { return quantile(a, 0.5); }
+
+Dataset median(const Dataset &d, const Dim dim) {
+  return quantile(d, dim, 0.5);
+}
+
+Dataset median(const Dataset &d) { return quantile(d, 0.5); }
+
+DataArray nanmedian(const DataArray &a, const Dim dim) {
+  return nanquantile(a, dim, 0.5);
+}
+
+DataArray nanmedian(const DataArray &a) { return nanquantile(a, 0.5); }
+
+Dataset nanmedian(const Dataset &d, const Dim dim) {
+  return nanquantile(d, dim, 0.5);
+}
+
+Dataset nanmedian(const Dataset &d) { return nanquantile(d, 0.5); }
+
+/// Return the `q`-quantile of all events per bin, ignoring masked events.
+///
+/// Events are selected directly from the event buffer using a thread-local
+/// scratch buffer, i.e., there are no per-bin allocations.
+Variable bins_quantile(const Variable &data, const double q) {
+  return bins_quantile_(data, q, false);
+}
+
+DataArray bins_quantile(const DataArray &a, const double q) {
+  return bins_quantile_(a, q, false);
+}
+
+/// Return the `q`-quantile of all events per bin, ignoring masked events and
+/// NaN values.
+Variable bins_nanquantile(const Variable &data, const double q) {
+  return bins_quantile_(data, q, true);
+}
+
+DataArray bins_nanquantile(const DataArray &a, const double q) {
+  return bins_quantile_(a, q, true);
+}
+
+/// Return the median of all events per bin, ignoring masked events.
+Variable bins_median(const Variable &data) { return bins_quantile(data, 0.5); }
+
+DataArray bins_median(const DataArray &a) { return bins_quantile(a, 0.5); }
+
+/// Return the median of all events per bin, ignoring masked events and NaN
+/// values.
+Variable bins_nanmedian(const Variable &data) {
+  return bins_nanquantile(data, 0.5);
+}
+
+DataArray bins_nanmedian(const DataArray &a) {
+  return bins_nanquantile(a, 0.5);
+}
+
+} // namespace scipp::dataset
@@ -112,10 +112,13 @@ template <class Maps> auto concat_maps(const Maps &maps, const Dim dim) {
 } // namespace
 
 DataArray concat(const scipp::span<const DataArray> das, const Dim dim) {
+  // Coords are typically much smaller than the data. Handling them first
+  // ensures that mismatching bin-edges are detected before copying the data.
+  const auto &coords = map(das, get_coords);
+  auto out_coords = concat_maps(coords, dim);
   auto out = DataArray(concat(map(das, get_data), dim), {},
                        concat_maps(map(das, get_masks), dim));
-  const auto &coords = map(das, get_coords);
-  for (auto &&[d, coord] : concat_maps(coords, dim)) {
+  for (auto &&[d, coord] : out_coords) {
     coord.set_aligned(d == dim ||
                       std::any_of(coords.begin(), coords.end(),
                                   [&d = d](auto &_) { return _.contains(d); }));
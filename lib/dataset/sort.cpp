@@ -2,10 +2,24 @@
 // Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
 #include "scipp/dataset/sort.h"
+#include "scipp/core/eigen.h"
 #include "scipp/core/parallel.h"
 #include "scipp/core/tag_util.h"
+#include "scipp/dataset/bins.h"
 #include "scipp/dataset/extract.h"
+#include "scipp/dataset/util.h"
+#include "scipp/variable/creation.h"
+#include "scipp/variable/variable_factory.h"
+
+#include "dataset_operations_common.h"
+#include "sort_detail.h"
 
 namespace scipp::dataset {
 
@@ -18,47 +32,378 @@ constexpr auto nan_sensitive_less = [](const auto &a, const auto &b) {
   return a < b;
 };
 
-template <class T> struct IndicesForSorting {
-  static Variable apply(const Variable &key, const SortOrder order) {
-    const auto size = key.dims()[key.dim()];
-    const auto values = key.values<T>();
-    std::vector<std::pair<T, scipp::index>> key_index;
-    key_index.reserve(size);
+/// Map a key to an unsigned integer with the same (ascending) order.
+///
+/// Negative and positive zero are mapped to the same value and all NaNs are
+/// mapped to the largest value, i.e., they are sorted to the end.
+template <class T> auto radix_key(const T &x) {
+  if constexpr (std::is_same_v<T, core::time_point>) {
+    return radix_key(x.time_since_epoch());
+  } else if constexpr (std::is_same_v<T, bool>) {
+    return static_cast<uint8_t>(x);
+  } else if constexpr (std::is_integral_v<T>) {
+    using U = std::make_unsigned_t<T>;
+    return static_cast<U>(static_cast<U>(x) ^ (U{1} << (8 * sizeof(T) - 1)));
+  } else {
+    using U = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+    constexpr U sign = U{1} << (8 * sizeof(T) - 1);
+    if (std::isnan(x))
+      return ~U{0};
+    const T y = x == T{0} ? T{0} : x;
+    U bits;
+    std::memcpy(&bits, &y, sizeof(T));
+    return static_cast<U>((bits & sign) ? ~bits : bits | sign);
+  }
+}
 
-    {
-      scipp::index i = 0;
-      for (const auto &value : key.values<T>())
-        key_index.emplace_back(value, i++);
+/// Return the permutation that stably sorts `keys` in ascending order.
+///
+/// Least-significant-digit radix sort with 11-bit digits. Each pass counts the
+/// digits of fixed chunks of the input in parallel and then scatters the
+/// chunks in parallel to their precomputed offsets. Passes in which all keys
+/// share the same digit are skipped, which is common for the high bits of,
+/// e.g., time stamps.
+template <class U>
+std::vector<scipp::index> radix_argsort(const std::vector<U> &keys) {
+  constexpr int bits = 11;
+  constexpr scipp::index nbucket = 1 << bits;
+  const auto size = scipp::size(keys);
+  const auto nchunk =
+      std::clamp(size / scipp::index(65536), scipp::index(1), scipp::index(64));
+  const auto chunk_begin = [size, nchunk](const scipp::index chunk) {
+    return size / nchunk * chunk + std::min(chunk, size % nchunk);
+  };
+  std::vector<std::pair<U, scipp::index>> key_index(size);
+  for (scipp::index i = 0; i < size; ++i)
+    key_index[i] = {keys[i], i};
+  std::vector<std::pair<U, scipp::index>> buffer(size);
+  std::vector<std::array<scipp::index, nbucket>> offsets(nchunk);
+  const auto chunks = core::parallel::blocked_range(0, nchunk, 1);
+  for (size_t shift = 0; shift < 8 * sizeof(U); shift += bits) {
+    const auto digit = [shift](const auto &item) {
+      return (item.first >> shift) & (nbucket - 1);
+    };
+    core::parallel::parallel_for(chunks, [&](const auto &range) {
+      for (auto chunk = range.begin(); chunk != range.end(); ++chunk) {
+        auto &count = offsets[chunk];
+        count.fill(0);
+        const auto end = chunk_begin(chunk + 1);
+        for (auto i = chunk_begin(chunk); i < end; ++i)
+          ++count[digit(key_index[i])];
+      }
+    });
+    scipp::index offset = 0;
+    bool skip = false;
+    for (scipp::index bucket = 0; bucket < nbucket; ++bucket) {
+      scipp::index total = 0;
+      for (auto &count : offsets) {
+        const auto n = count[bucket];
+        count[bucket] = offset;
+        offset += n;
+        total += n;
+      }
+      skip |= total == size;
     }
+    if (skip)
+      continue;
+    core::parallel::parallel_for(chunks, [&](const auto &range) {
+      for (auto chunk = range.begin(); chunk != range.end(); ++chunk) {
+        auto next = offsets[chunk];
+        const auto end = chunk_begin(chunk + 1);
+        for (auto i = chunk_begin(chunk); i < end; ++i)
+          buffer[next[digit(key_index[i])]++] = key_index[i];
+      }
+    });
+    std::swap(key_index, buffer);
+  }
+  std::vector<scipp::index> indices(size);
+  std::transform(key_index.begin(), key_index.end(), indices.begin(),
+                 [](const auto &item) { return item.second; });
+  return indices;
+}
 
-    if (order == SortOrder::Ascending)
-      core::parallel::parallel_sort(
-          key_index.begin(), key_index.end(), [](const auto &a, const auto &b) {
-            return nan_sensitive_less(a.first, b.first);
-          });
-    else
-      core::parallel::parallel_sort(
-          key_index.begin(), key_index.end(), [](const auto &a, const auto &b) {
-            return nan_sensitive_less(b.first, a.first);
+template <class T> struct Argsort {
+  static std::vector<scipp::index> apply(const Variable &key,
+                                         const SortOrder order) {
+    const auto values = key.values<T>();
+    if constexpr (std::is_same_v<T, std::string>) {
+      std::vector<scipp::index> indices(values.size());
+      std::iota(indices.begin(), indices.end(), scipp::index(0));
+      const auto &v = values;
+      if (order == SortOrder::Ascending)
+        std::stable_sort(indices.begin(), indices.end(),
+                         [&v](const auto a, const auto b) {
+                           return nan_sensitive_less(v[a], v[b]);
+                         });
+      else
+        std::stable_sort(indices.begin(), indices.end(),
+                         [&v](const auto a, const auto b) {
+                           return nan_sensitive_less(v[b], v[a]);
+                         });
+      return indices;
+    } else {
+      // Inverting the bits of the keys reverses their order while preserving
+      // the order of equal keys, i.e., the sort is stable also if descending.
+      using U = decltype(radix_key(std::declval<T>()));
+      std::vector<U> keys(values.size());
+      const auto invert = order == SortOrder::Descending;
+      std::transform(values.begin(), values.end(), keys.begin(),
+                     [invert](const auto &x) {
+                       const auto k = radix_key(x);
+                       return invert ? static_cast<U>(~k) : k;
+                     });
+      return radix_argsort(keys);
+    }
+  }
+};
+
+template <class T> struct Gather {
+  static void apply(const Variable &in, Variable &out, const Dim dim,
+                    const scipp::span<const scipp::index> indices) {
+    if (out.dims().volume() == 0)
+      return;
+    const auto size = in.dims()[dim];
+    const auto count = scipp::size(indices);
+    const auto inner = in.strides()[in.dims().index(dim)];
+    const auto outer = in.dims().volume() / (size * inner);
+    const auto gather = [&](const T *src, T *dst) {
+      core::parallel::parallel_for(
+          core::parallel::blocked_range(0, outer * count),
+          [&](const auto &range) {
+            for (auto i = range.begin(); i != range.end(); ++i)
+              std::copy_n(src + (i / count * size + indices[i % count]) * inner,
+                          inner, dst + i * inner);
           });
+    };
+    gather(in.values<T>().data(), out.values<T>().data());
+    if (in.has_variances())
+      gather(in.variances<T>().data(), out.variances<T>().data());
+  }
+};
+
+using gather_dtypes =
+    core::CallDType<double, float, int64_t, int32_t, bool, std::string,
+                    core::time_point, Eigen::Vector3d, scipp::index_pair>;
+
+bool can_gather(const Variable &var) {
+  for (const auto type :
+       {dtype<double>, dtype<float>, dtype<int64_t>, dtype<int32_t>,
+        dtype<bool>, dtype<std::string>, dtype<core::time_point>,
+        dtype<Eigen::Vector3d>, dtype<scipp::index_pair>})
+    if (var.dtype() == type)
+      return true;
+  return false;
+}
 
-    auto indices =
-        makeVariable<scipp::index_pair>(Dims{key.dim()}, Shape{size});
-    std::transform(key_index.begin(), key_index.end(),
-                   indices.values<scipp::index_pair>().as_span().begin(),
-                   [](const auto &item) {
-                     return std::pair{item.second, item.second + 1};
-                   });
-    return indices;
+/// Return a copy of the bins of `binned` given by `indices`, with a compact
+/// buffer containing only the events of those bins.
+Variable copy_bins(const Variable &indices, const Variable &binned) {
+  if (binned.dtype() == dtype<bucket<Variable>>) {
+    const auto &[_, dim, buffer] = binned.constituents<Variable>();
+    return copy(make_bins_no_validate(indices, dim, buffer));
+  } else if (binned.dtype() == dtype<bucket<DataArray>>) {
+    const auto &[_, dim, buffer] = binned.constituents<DataArray>();
+    return copy(make_bins_no_validate(indices, dim, buffer));
+  } else {
+    const auto &[_, dim, buffer] = binned.constituents<Dataset>();
+    return copy(make_bins_no_validate(indices, dim, buffer));
+  }
+}
+
+/// Number of bits required to represent `x`.
+int bit_width(uint64_t x) {
+  int bits = 0;
+  for (; x != 0; x >>= 1)
+    ++bits;
+  return bits;
+}
+
+/// Replace codes by their rank among the unique codes, return the largest
+/// rank.
+uint64_t factorize(std::vector<uint64_t> &codes) {
+  const auto perm = radix_argsort(codes);
+  std::vector<uint64_t> ranks(codes.size());
+  uint64_t rank = 0;
+  for (size_t i = 0; i < perm.size(); ++i) {
+    if (i > 0 && codes[perm[i]] != codes[perm[i - 1]])
+      ++rank;
+    ranks[perm[i]] = rank;
+  }
+  codes = std::move(ranks);
+  return rank;
+}
+
+/// Return codes for the values of `key` and the largest code.
+///
+/// Codes have the same (ascending) order as the values, start at zero, and
+/// are equal if and only if the values are equal, treating all NaNs as
+/// equal.
+template <class T> struct KeyCodes {
+  static std::pair<std::vector<uint64_t>, uint64_t> apply(const Variable &key) {
+    const auto values = key.values<T>();
+    std::vector<uint64_t> codes(values.size());
+    if (codes.empty())
+      return {std::move(codes), 0};
+    if constexpr (std::is_same_v<T, std::string>) {
+      const auto perm = Argsort<T>::apply(key, SortOrder::Ascending);
+      uint64_t rank = 0;
+      for (size_t i = 0; i < perm.size(); ++i) {
+        if (i > 0 && values[perm[i]] != values[perm[i - 1]])
+          ++rank;
+        codes[perm[i]] = rank;
+      }
+      return {std::move(codes), rank};
+    } else {
+      std::transform(values.begin(), values.end(), codes.begin(),
+                     [](const auto &x) { return radix_key(x); });
+      const auto [min, max] = std::minmax_element(codes.begin(), codes.end());
+      const auto offset = *min;
+      const auto range = *max - offset;
+      for (auto &code : codes)
+        code -= offset;
+      return {std::move(codes), range};
+    }
   }
 };
 
-Variable indices_for_sorting(const Variable &key, const SortOrder order) {
-  return core::CallDType<
-      double, float, int64_t, int32_t, bool, std::string,
-      core::time_point>::apply<IndicesForSorting>(key.dtype(), key, order);
+} // namespace
+
+namespace sort_detail {
+
+/// Return the permutation of indices that sorts `key`.
+///
+/// The sort is stable. NaNs are placed at the end for ascending order and at
+/// the beginning for descending order.
+std::vector<scipp::index> argsort(const Variable &key, const SortOrder order) {
+  return core::CallDType<double, float, int64_t, int32_t, bool, std::string,
+                         core::time_point>::apply<Argsort>(key.dtype(), key,
+                                                           order);
 }
 
+/// Return the permutation that stably sorts packed keys in ascending order.
+std::vector<scipp::index> argsort(const std::vector<uint64_t> &packed) {
+  return radix_argsort(packed);
+}
+
+/// Return a composite key for lexicographic sorting or grouping by `keys`.
+///
+/// The codes of the individual keys are bit-packed, with the first key in the
+/// most significant bits. Integer keys are packed directly as offsets from
+/// their minimum if the range of values allows for this. Otherwise, the keys
+/// or the partial composite key are first replaced by ranks among their
+/// unique values, such that an arbitrary number of keys can be packed into 64
+/// bits as long as their number of unique combinations is representable.
+std::vector<uint64_t> pack_keys(const std::vector<Variable> &keys) {
+  std::vector<uint64_t> packed;
+  uint64_t max_packed = 0;
+  for (const auto &key : keys) {
+    auto [codes, max_code] =
+        core::CallDType<double, float, int64_t, int32_t, bool, std::string,
+                        core::time_point>::apply<KeyCodes>(key.dtype(), key);
+    if (&key == &keys.front()) {
+      packed = std::move(codes);
+      max_packed = max_code;
+      continue;
+    }
+    if (bit_width(max_packed) + bit_width(max_code) > 64)
+      max_packed = factorize(packed);
+    if (bit_width(max_packed) + bit_width(max_code) > 64)
+      max_code = factorize(codes);
+    const auto bits = bit_width(max_code);
+    if (bits == 64) { // only if all previous keys are constant
+      packed = std::move(codes);
+    } else {
+      for (size_t i = 0; i < packed.size(); ++i)
+        packed[i] = (packed[i] << bits) | codes[i];
+    }
+    max_packed = bits == 64 ? max_code : (max_packed << bits) | max_code;
+  }
+  return packed;
+}
+
+/// Return a copy of `var` with slices along `dim` selected by `indices`.
+///
+/// Indices may be repeated or omitted, i.e., this is not limited to
+/// permutations.
+/// Dense variables are handled by a single parallel gather, copying contiguous
+/// blocks of the inner dims. For binned variables the bin indices are gathered
+/// and the selected bins are then copied into a new, compact buffer. Other
+/// variables fall back to extracting every index as a separate range.
+Variable gather(const Variable &var, const Dim dim,
+                const scipp::span<const scipp::index> indices) {
+  if (!var.dims().contains(dim))
+    return copy(var);
+  Variable out;
+  if (can_gather(var)) {
+    // Transposed or sliced inputs are copied first, such that the gather can
+    // operate on contiguous blocks.
+    const auto in =
+        Strides(var.strides()) == Strides(var.dims()) ? var : copy(var);
+    auto dims = in.dims();
+    dims.resize(dim, scipp::size(indices));
+    out = empty_like(in, dims);
+    gather_dtypes::apply<Gather>(in.dtype(), in, out, dim, indices);
+  } else if (is_bins(var)) {
+    out = copy_bins(gather(var.bin_indices(), dim, indices), var);
+  } else {
+    auto ranges =
+        makeVariable<scipp::index_pair>(Dims{dim}, Shape{indices.size()});
+    std::transform(indices.begin(), indices.end(),
+                   ranges.values<scipp::index_pair>().begin(),
+                   [](const auto i) { return std::pair{i, i + 1}; });
+    out = extract_ranges(ranges, var, dim);
+  }
+  out.set_aligned(var.is_aligned());
+  return out;
+}
+
+void expect_valid_keys(const std::vector<Variable> &keys) {
+  if (keys.empty())
+    throw std::invalid_argument("Expected at least one key.");
+  for (const auto &key : keys) {
+    if (key.dims().ndim() != 1)
+      throw except::DimensionError("Keys must be 1-dimensional, got " +
+                                   to_string(key.dims()) + '.');
+    if (key.dims() != keys.front().dims())
+      throw except::DimensionError("Keys must have identical dimensions, got " +
+                                   to_string(keys.front().dims()) + " and " +
+                                   to_string(key.dims()) + '.');
+  }
+}
+
+DataArray gather(const DataArray &da, const Dim dim,
+                 const scipp::span<const scipp::index> indices) {
+  return transform(strip_edges_along(da, dim), [&](const Variable &var) {
+    return gather(var, dim, indices);
+  });
+}
+
+Dataset gather(const Dataset &ds, const Dim dim,
+               const scipp::span<const scipp::index> indices) {
+  const auto gather_ = [&](const Variable &var) {
+    return gather(var, dim, indices);
+  };
+  const auto in = strip_edges_along(ds, dim);
+  // Build a new dataset since the length of `dim` may change.
+  core::Dict<std::string, DataArray> items;
+  for (const auto &item : in)
+    items.insert_or_assign(
+        item.name(),
+        DataArray(gather_(item.data()), {},
+                  transform_map<Masks::holder_type>(item.masks(), gather_),
+                  transform_map<Attrs::holder_type>(item.attrs(), gather_),
+                  item.name()));
+  return Dataset(std::move(items),
+                 transform_map<Coords::holder_type>(in.coords(), gather_));
+}
+
+} // namespace sort_detail
+
+namespace {
+
+using sort_detail::argsort;
+using sort_detail::gather;
+
 void require_same_shape(const Dimensions &var_dims, const Dimensions &key_dims,
                         const Dim dim) {
   if (var_dims[dim] != key_dims[dim])
@@ -68,19 +413,45 @@ void require_same_shape(const Dimensions &var_dims, const Dimensions &key_dims,
         std::to_string(var_dims[dim]) + ". Lengths must agree.");
 }
 
+/// Return the permutation of indices that sorts lexicographically by `keys`.
+std::vector<scipp::index> argsort(const std::vector<Variable> &keys,
+                                  const SortOrder order) {
+  sort_detail::expect_valid_keys(keys);
+  if (keys.size() == 1)
+    return argsort(keys.front(), order);
+  auto packed = sort_detail::pack_keys(keys);
+  if (order == SortOrder::Descending)
+    for (auto &key : packed)
+      key = ~key;
+  return argsort(packed);
+}
+
+template <class T>
+std::vector<Variable> get_keys(const T &obj, const std::vector<Dim> &keys) {
+  std::vector<Variable> out;
+  out.reserve(keys.size());
+  for (const auto &key : keys) {
+    if constexpr (std::is_same_v<T, Dataset>)
+      out.emplace_back(obj.coords()[key]);
+    else
+      out.emplace_back(obj.meta()[key]);
+  }
+  return out;
+}
+
 } // namespace
 
 /// Return a Variable sorted based on key.
 Variable sort(const Variable &var, const Variable &key, const SortOrder order) {
   require_same_shape(var.dims(), key.dims(), key.dim());
-  return extract_ranges(indices_for_sorting(key, order), var, key.dim());
+  return gather(var, key.dim(), argsort(key, order));
 }
 
 /// Return a DataArray sorted based on key.
 DataArray sort(const DataArray &array, const Variable &key,
                const SortOrder order) {
   require_same_shape(array.dims(), key.dims(), key.dim());
-  return extract_ranges(indices_for_sorting(key, order), array, key.dim());
+  return gather(array, key.dim(), argsort(key, order));
 }
 
 /// Return a DataArray sorted based on coordinate.
@@ -91,7 +462,7 @@ DataArray sort(const DataArray &array, const Dim &key, const SortOrder order) {
 /// Return a Dataset sorted based on key.
 Dataset sort(const Dataset &dataset, const Variable &key,
              const SortOrder order) {
-  return extract_ranges(indices_for_sorting(key, order), dataset, key.dim());
+  return gather(dataset, key.dim(), argsort(key, order));
 }
 
 /// Return a Dataset sorted based on coordinate.
@@ -99,4 +470,44 @@ Dataset sort(const Dataset &dataset, const Dim &key, const SortOrder order) {
   return sort(dataset, dataset.coords()[key], order);
 }
 
+/// Return a Variable sorted lexicographically based on keys.
+///
+/// The first key is the most significant. All keys must be 1-D with identical
+/// dimensions.
+Variable sort(const Variable &var, const std::vector<Variable> &keys,
+              const SortOrder order) {
+  const auto indices = argsort(keys, order);
+  const auto dim = keys.front().dim();
+  require_same_shape(var.dims(), keys.front().dims(), dim);
+  return gather(var, dim, indices);
+}
+
+/// Return a DataArray sorted lexicographically based on keys.
+DataArray sort(const DataArray &array, const std::vector<Variable> &keys,
+               const SortOrder order) {
+  const auto indices = argsort(keys, order);
+  const auto dim = keys.front().dim();
+  require_same_shape(array.dims(), keys.front().dims(), dim);
+  return gather(array, dim, indices);
+}
+
+/// Return a DataArray sorted lexicographically based on coordinates.
+DataArray sort(const DataArray &array, const std::vector<Dim> &keys,
+               const SortOrder order) {
+  return sort(array, get_keys(array, keys), order);
+}
+
+/// Return a Dataset sorted lexicographically based on keys.
+Dataset sort(const Dataset &dataset, const std::vector<Variable> &keys,
+             const SortOrder order) {
+  const auto indices = argsort(keys, order);
+  return gather(dataset, keys.front().dim(), indices);
+}
+
+/// Return a Dataset sorted lexicographically based on coordinates.
+Dataset sort(const Dataset &dataset, const std::vector<Dim> &keys,
+             const SortOrder order) {
+  return sort(dataset, get_keys(dataset, keys), order);
+}
+
 } // namespace scipp::dataset
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "scipp/core/flags.h"
+#include "scipp/dataset/dataset.h"
+#include "scipp/variable/variable.h"
+
+namespace scipp::dataset::sort_detail {
+
+std::vector<scipp::index> argsort(const Variable &key, const SortOrder order);
+std::vector<scipp::index> argsort(const std::vector<uint64_t> &packed);
+
+std::vector<uint64_t> pack_keys(const std::vector<Variable> &keys);
+
+Variable gather(const Variable &var, const Dim dim,
+                const scipp::span<const scipp::index> indices);
+DataArray gather(const DataArray &da, const Dim dim,
+                 const scipp::span<const scipp::index> indices);
+Dataset gather(const Dataset &ds, const Dim dim,
+               const scipp::span<const scipp::index> indices);
+
+void expect_valid_keys(const std::vector<Variable> &keys);
+
+} // namespace scipp::dataset::sort_detail
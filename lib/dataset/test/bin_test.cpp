@@ -175,6 +175,22 @@ protected:
     EXPECT_EQ(a.coords(), b.coords());
     EXPECT_EQ(a.attrs(), b.attrs());
   }
+
+  /// Sums of bins are accumulated in partial sums, so the result may differ
+  /// from a histogram in the last bits.
+  void expect_sum_near(const DataArray &summed, const DataArray &expected) {
+    const auto rtol = 1e-14 * units::one;
+    const auto atol = 1e-12 * units::counts;
+    const auto atol_variances = 1e-12 * (units::counts * units::counts);
+    EXPECT_TRUE(all(isclose(values(summed.data()), values(expected.data()),
+                            rtol, atol))
+                    .value<bool>());
+    EXPECT_TRUE(all(isclose(variances(summed.data()),
+                            variances(expected.data()), rtol, atol_variances))
+                    .value<bool>());
+    EXPECT_EQ(summed.masks(), expected.masks());
+    EXPECT_EQ(summed.coords(), expected.coords());
+  }
 };
 
 INSTANTIATE_TEST_SUITE_P(InputSize, BinTest,
@@ -443,13 +459,14 @@ TEST_P(BinTest, rebin_masked) {
   auto binned = bin(table, {edges_x_coarse});
   binned.masks().set("x-mask", makeVariable<bool>(Dims{Dim::X}, Shape{2},
                                                   Values{false, true}));
-  EXPECT_EQ(bins_sum(bin(binned, {edges_x})), histogram(binned, edges_x));
+  expect_sum_near(bins_sum(bin(binned, {edges_x})), histogram(binned, edges_x));
   if (table.dims().volume() > 0) {
     EXPECT_NE(bin(binned, {edges_x}), bin(table, {edges_x}));
     EXPECT_NE(bins_sum(bin(binned, {edges_x})), histogram(table, edges_x));
     binned.masks().erase("x-mask");
     EXPECT_EQ(bin(binned, {edges_x}), bin(table, {edges_x}));
-    EXPECT_EQ(bins_sum(bin(binned, {edges_x})), histogram(table, edges_x));
+    expect_sum_near(bins_sum(bin(binned, {edges_x})),
+                    histogram(table, edges_x));
   }
 }
 
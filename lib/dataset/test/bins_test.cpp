@@ -13,6 +13,7 @@
 #include "scipp/variable/bins.h"
 #include "scipp/variable/math.h"
 #include "scipp/variable/reduction.h"
+#include "scipp/variable/util.h"
 #include "scipp/variable/variable_factory.h"
 
 using namespace scipp;
@@ -494,3 +495,80 @@ TEST_F(DatasetBinsTest, concatenate) {
   buffer1.coords().set(Dim("scalar2"), 1.0 * units::m);
   check_fail();
 }
+
+class DataArrayBinsSliceSortedTest : public ::testing::Test {
+protected:
+  Variable indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{2}, Values{std::pair{0, 3}, std::pair{3, 6}});
+  Variable z = makeVariable<double>(Dims{Dim::X}, Shape{6}, units::s,
+                                    Values{1, 2, 3, 1, 4, 5});
+  Variable data = makeVariable<double>(Dims{Dim::X}, Shape{6},
+                                       Values{1, 2, 3, 4, 5, 6});
+  DataArray buffer = DataArray(data, {{Dim::Z, z}});
+  Variable var = make_bins(indices, Dim::X, buffer);
+};
+
+TEST_F(DataArrayBinsSliceSortedTest, is_sorted_by) {
+  EXPECT_TRUE(buckets::is_sorted_by(var, Dim::Z));
+  var.bin_buffer<DataArray>().coords().set(Dim::Z, -z);
+  EXPECT_FALSE(buckets::is_sorted_by(var, Dim::Z));
+}
+
+TEST_F(DataArrayBinsSliceSortedTest, is_sorted_by_is_recomputed_after_write) {
+  EXPECT_TRUE(buckets::is_sorted_by(var, Dim::Z));
+  z.values<double>()[1] = 0.0;
+  EXPECT_FALSE(buckets::is_sorted_by(var, Dim::Z));
+  z.values<double>()[1] = 2.0;
+  EXPECT_TRUE(buckets::is_sorted_by(var, Dim::Z));
+}
+
+TEST_F(DataArrayBinsSliceSortedTest,
+       is_sorted_by_is_recomputed_after_write_to_indices) {
+  EXPECT_TRUE(buckets::is_sorted_by(var, Dim::Z));
+  indices.values<scipp::index_pair>()[0] = std::pair{0, 4};
+  EXPECT_FALSE(buckets::is_sorted_by(var, Dim::Z));
+}
+
+TEST_F(DataArrayBinsSliceSortedTest, is_sorted_by_depends_on_indices) {
+  const auto single_bin = make_bins(
+      makeVariable<scipp::index_pair>(Values{std::pair{0, 6}}), Dim::X,
+      buffer);
+  EXPECT_TRUE(buckets::is_sorted_by(var, Dim::Z));
+  EXPECT_FALSE(buckets::is_sorted_by(single_bin, Dim::Z));
+  EXPECT_TRUE(buckets::is_sorted_by(var, Dim::Z));
+  EXPECT_TRUE(buckets::is_sorted_by(var.slice({Dim::Y, 1}), Dim::Z));
+}
+
+TEST_F(DataArrayBinsSliceSortedTest, slice_sorted) {
+  const auto result =
+      buckets::slice_sorted(var, Dim::Z, 2.0 * units::s, 4.5 * units::s);
+  const auto expected_indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{2}, Values{std::pair{1, 3}, std::pair{4, 5}});
+  EXPECT_EQ(result, make_bins(expected_indices, Dim::X, buffer));
+  // The buffer is shared, not copied.
+  EXPECT_TRUE(result.bin_buffer<DataArray>().data().is_same(data));
+}
+
+TEST_F(DataArrayBinsSliceSortedTest, slice_sorted_empty_range) {
+  const auto result =
+      buckets::slice_sorted(var, Dim::Z, 4.5 * units::s, 2.0 * units::s);
+  const auto [begin, end] = unzip(result.bin_indices());
+  EXPECT_EQ(begin, end);
+}
+
+TEST_F(DataArrayBinsSliceSortedTest, slice_sorted_bad_bounds) {
+  EXPECT_THROW_DISCARD(
+      buckets::slice_sorted(var, Dim::Z, 2.0 * units::m, 4.0 * units::m),
+      except::UnitError);
+  EXPECT_THROW_DISCARD(buckets::slice_sorted(var, Dim::Z,
+                                             int64_t{2} * units::s,
+                                             int64_t{4} * units::s),
+                       except::TypeError);
+}
+
+TEST_F(DataArrayBinsSliceSortedTest, slice_sorted_requires_sorted) {
+  var.bin_buffer<DataArray>().coords().set(Dim::Z, -z);
+  EXPECT_THROW_DISCARD(
+      buckets::slice_sorted(var, Dim::Z, -4.0 * units::s, -2.0 * units::s),
+      except::BinnedDataError);
+}
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+#include "scipp/dataset/bins.h"
+#include "scipp/dataset/dataset.h"
+#include "scipp/dataset/extract.h"
+#include "scipp/dataset/shape.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/shape.h"
+
+#include "test_macros.h"
+
+using namespace scipp;
+
+class ExtractTest : public ::testing::Test {
+protected:
+  Variable condition = makeVariable<bool>(Dims{Dim::X}, Shape{4},
+                                          Values{true, false, true, true});
+  Variable var = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 4},
+                                      units::m,
+                                      Values{1, 2, 3, 4, 5, 6, 7, 8});
+  Variable expected = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                           units::m, Values{1, 3, 4, 5, 7, 8});
+};
+
+TEST_F(ExtractTest, variable) {
+  EXPECT_EQ(extract(var, condition), expected);
+  EXPECT_EQ(extract(transpose(var), condition), transpose(expected));
+}
+
+TEST_F(ExtractTest, variable_all_or_nothing) {
+  EXPECT_EQ(extract(var, makeVariable<bool>(Dims{Dim::X}, Shape{4},
+                                            Values{true, true, true, true})),
+            var);
+  EXPECT_EQ(extract(var, makeVariable<bool>(Dims{Dim::X}, Shape{4},
+                                            Values{false, false, false,
+                                                   false})),
+            var.slice({Dim::X, 0, 0}));
+}
+
+TEST_F(ExtractTest, data_array) {
+  const auto x =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1, 2, 3, 4});
+  const auto edges =
+      makeVariable<double>(Dims{Dim::X}, Shape{5}, Values{0, 1, 2, 3, 4});
+  const auto y = makeVariable<double>(Dims{Dim::Y}, Shape{2}, Values{1, 2});
+  const auto mask = makeVariable<bool>(Dims{Dim::X}, Shape{4},
+                                       Values{false, false, true, false});
+  const DataArray da(var, {{Dim::X, x}, {Dim::Y, y}, {Dim("edges"), edges}},
+                     {{"mask", mask}});
+  const auto result = extract(da, condition);
+  EXPECT_EQ(result.data(), expected);
+  EXPECT_EQ(result.coords()[Dim::X], extract(x, condition));
+  EXPECT_EQ(result.coords()[Dim::Y], y);
+  EXPECT_FALSE(result.coords().contains(Dim("edges")));
+  EXPECT_EQ(result.masks()["mask"], extract(mask, condition));
+}
+
+TEST_F(ExtractTest, dataset) {
+  const auto x =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1, 2, 3, 4});
+  const Dataset ds(
+      {{"a", DataArray(var)}, {"b", DataArray(var.slice({Dim::Y, 0}))}},
+      {{Dim::X, x}});
+  const auto result = extract(ds, condition);
+  EXPECT_EQ(result["a"].data(), expected);
+  EXPECT_EQ(result["b"].data(), expected.slice({Dim::Y, 0}));
+  EXPECT_EQ(result.coords()[Dim::X], extract(x, condition));
+}
+
+TEST_F(ExtractTest, binned) {
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::X}, Shape{4},
+      Values{std::pair{0, 2}, std::pair{2, 3}, std::pair{3, 3},
+             std::pair{3, 6}});
+  const auto events = makeVariable<double>(Dims{Dim::Event}, Shape{6},
+                                           Values{1, 2, 3, 4, 5, 6});
+  const DataArray buffer(events, {{Dim::X, events + events}});
+  const auto binned = make_bins(indices, Dim::Event, buffer);
+  const auto result = extract(binned, condition);
+  const auto expected_indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::X}, Shape{3},
+      Values{std::pair{0, 2}, std::pair{2, 2}, std::pair{2, 5}});
+  const auto expected_events = makeVariable<double>(
+      Dims{Dim::Event}, Shape{5}, Values{1, 2, 4, 5, 6});
+  const DataArray expected_buffer(
+      expected_events, {{Dim::X, expected_events + expected_events}});
+  EXPECT_EQ(result, make_bins(expected_indices, Dim::Event, expected_buffer));
+  // Events of bins that are not selected are not copied.
+  EXPECT_EQ(result.bin_buffer<DataArray>().dims()[Dim::Event], 5);
+}
+
+TEST_F(ExtractTest, many_blocks) {
+  const scipp::index size = 200003;
+  auto values = makeVariable<int64_t>(Dims{Dim::X}, Shape{size});
+  std::iota(values.values<int64_t>().begin(), values.values<int64_t>().end(),
+            0);
+  auto select = makeVariable<bool>(Dims{Dim::X}, Shape{size});
+  std::vector<int64_t> selected;
+  for (scipp::index i = 0; i < size; ++i) {
+    const bool keep = i % 3 == 0 || (i > 70000 && i < 140000);
+    select.values<bool>()[i] = keep;
+    if (keep)
+      selected.push_back(i);
+  }
+  EXPECT_EQ(extract(values, select),
+            makeVariable<int64_t>(Dims{Dim::X}, Shape{selected.size()},
+                                  Values(selected.begin(), selected.end())));
+}
+
+TEST_F(ExtractTest, fail_bad_condition) {
+  EXPECT_THROW_DISCARD(extract(var, var), except::TypeError);
+  EXPECT_THROW_DISCARD(
+      extract(var, makeVariable<bool>(Dims{Dim::Z}, Shape{4})),
+      except::DimensionError);
+}
@@ -122,6 +122,64 @@ TEST_F(GroupbyTest, by_attr) {
   EXPECT_EQ(grouped_coord, grouped_attr);
 }
 
+TEST(GroupbyMultiKeyTest, sum) {
+  const DataArray da(
+      makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 5}, units::m,
+                           Values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}),
+      {{Dim("k1"),
+        makeVariable<int64_t>(Dims{Dim::X}, Shape{5}, Values{0, 1, 0, 1, 0})},
+       {Dim("k2"), makeVariable<std::string>(Dims{Dim::X}, Shape{5},
+                                             Values{"a", "a", "a", "b", "a"})},
+       {Dim::Y, makeVariable<double>(Dims{Dim::Y}, Shape{2}, Values{1, 2})}});
+  const DataArray expected(
+      makeVariable<double>(Dims{Dim::Y, Dim::Group}, Shape{2, 3}, units::m,
+                           Values{9, 2, 4, 24, 7, 9}),
+      {{Dim("k1"),
+        makeVariable<int64_t>(Dims{Dim::Group}, Shape{3}, Values{0, 1, 1})},
+       {Dim("k2"), makeVariable<std::string>(Dims{Dim::Group}, Shape{3},
+                                             Values{"a", "a", "b"})},
+       {Dim::Y, makeVariable<double>(Dims{Dim::Y}, Shape{2}, Values{1, 2})}});
+  const auto grouped = groupby(da, std::vector{Dim("k1"), Dim("k2")});
+  EXPECT_EQ(grouped.dim(), Dim::Group);
+  EXPECT_EQ(grouped.size(), 3);
+  EXPECT_EQ(grouped.sum(Dim::X), expected);
+}
+
+TEST(GroupbyMultiKeyTest, dataset_mean) {
+  Dataset d;
+  d.setData("a", makeVariable<double>(Dims{Dim::X}, Shape{4}, units::s,
+                                      Values{1, 2, 3, 4}));
+  d.setCoord(Dim("k1"), makeVariable<double>(Dims{Dim::X}, Shape{4},
+                                             Values{2.0, 1.0, 2.0, 1.0}));
+  d.setCoord(Dim("k2"), makeVariable<int32_t>(Dims{Dim::X}, Shape{4},
+                                              Values{7, 7, 7, 8}));
+  Dataset expected;
+  expected.setData("a", makeVariable<double>(Dims{Dim::Group}, Shape{3},
+                                             units::s, Values{2, 4, 2}));
+  expected.setCoord(Dim("k1"), makeVariable<double>(Dims{Dim::Group}, Shape{3},
+                                                    Values{1.0, 1.0, 2.0}));
+  expected.setCoord(Dim("k2"), makeVariable<int32_t>(Dims{Dim::Group},
+                                                     Shape{3}, Values{7, 8, 7}));
+  EXPECT_EQ(groupby(d, std::vector{Dim("k1"), Dim("k2")}).mean(Dim::X),
+            expected);
+}
+
+TEST(GroupbyMultiKeyTest, fail_bad_keys) {
+  DataArray da(
+      makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{3, 2}),
+      {{Dim("k1"), makeVariable<int64_t>(Dims{Dim::X}, Shape{3})},
+       {Dim("k2"), makeVariable<int64_t>(Dims{Dim::X, Dim::Y}, Shape{3, 2})},
+       {Dim("var"), makeVariable<double>(Dims{Dim::X}, Shape{3},
+                                         Values{1, 2, 3}, Variances{1, 2, 3})}});
+  EXPECT_THROW(groupby(da, std::vector{Dim("k1"), Dim("k2")}),
+               except::DimensionError);
+  EXPECT_THROW(groupby(da, std::vector{Dim("k1"), Dim("var")}),
+               except::VariancesError);
+  EXPECT_THROW(groupby(da, std::vector{Dim("k1"), Dim("missing")}),
+               except::NotFoundError);
+  EXPECT_THROW(groupby(da, std::vector<Dim>{}), std::invalid_argument);
+}
+
 struct GroupbyReductionTest : public ::testing::Test {
   GroupbyReductionTest() {
     d.setData("a", makeVariable<double>(Dimensions{{Dim::Z, 2}, {Dim::X, 3}},
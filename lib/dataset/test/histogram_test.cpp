@@ -14,6 +14,7 @@
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/comparison.h"
 #include "scipp/variable/shape.h"
+#include "scipp/variable/to_unit.h"
 
 using namespace scipp;
 using namespace scipp::dataset;
@@ -279,6 +280,36 @@ TEST(HistogramTest, dense_vs_binned) {
   }
 }
 
+TEST(HistogramTest, edges_in_different_unit) {
+  using testdata::make_table;
+  for (auto table : {make_table(100), make_table(1000)}) {
+    table.coords()[Dim::X].setUnit(units::m);
+    auto converted = copy(table);
+    converted.coords().set(Dim::X, to_unit(table.coords()[Dim::X], units::mm));
+    const auto binned = bin(table, {makeVariable<double>(
+                                       Dims{Dim::X}, Shape{2}, units::m,
+                                       Values{-2, 2})});
+    const auto linspace =
+        makeVariable<double>(Dims{Dim::X}, Shape{5}, units::mm,
+                             Values{-2000, -1000, 0, 1000, 2000});
+    const auto sorted = makeVariable<double>(
+        Dims{Dim::X}, Shape{4}, units::mm, Values{-2000, -100, 300, 1500});
+    for (const auto &edges : {linspace, sorted}) {
+      const auto expected = histogram(converted, edges);
+      EXPECT_EQ(histogram(table, edges), expected);
+      EXPECT_EQ(histogram(binned, edges), expected);
+    }
+  }
+}
+
+TEST(HistogramTest, edges_in_incompatible_unit) {
+  auto table = testdata::make_table(100);
+  table.coords()[Dim::X].setUnit(units::m);
+  const auto edges =
+      makeVariable<double>(Dims{Dim::X}, Shape{2}, units::s, Values{-2, 2});
+  EXPECT_THROW_DISCARD(histogram(table, edges), except::UnitError);
+}
+
 struct Histogram1DTest : public ::testing::Test {
 protected:
   Histogram1DTest() {
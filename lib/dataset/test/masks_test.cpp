@@ -37,3 +37,33 @@ TEST(MasksTest, irreducible_mask) {
   EXPECT_EQ(combined_y_and_xy_mask ^ irreducible_mask(a.masks(), Dim::Y), none);
   EXPECT_EQ(irreducible_mask(a.masks(), Dim::Z), Variable{});
 }
+
+TEST(MasksTest, irreducible_mask_single_mask_is_not_copied) {
+  DataArray a(makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{2, 3}));
+  a.masks().set("x", makeVariable<bool>(Dims{Dim::X}, Shape{2},
+                                        Values{true, false}));
+  const auto mask = irreducible_mask(a.masks(), Dim::X);
+  EXPECT_TRUE(mask.is_same(a.masks()["x"]));
+  EXPECT_TRUE(mask.is_readonly());
+  EXPECT_FALSE(a.masks()["x"].is_readonly());
+}
+
+TEST(MasksTest, irreducible_mask_does_not_modify_inputs) {
+  DataArray a(makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{2, 3}));
+  const auto x0 =
+      makeVariable<bool>(Dims{Dim::X}, Shape{2}, Values{true, false});
+  const auto x1 =
+      makeVariable<bool>(Dims{Dim::X}, Shape{2}, Values{false, true});
+  const auto xy = makeVariable<bool>(
+      Dims{Dim::X, Dim::Y}, Shape{2, 3},
+      Values{false, false, false, false, true, false});
+  a.masks().set("x0", copy(x0));
+  a.masks().set("x1", copy(x1));
+  a.masks().set("xy", copy(xy));
+  EXPECT_EQ(irreducible_mask(a.masks(), Dim::X),
+            makeVariable<bool>(Dims{Dim::X, Dim::Y}, Shape{2, 3},
+                               Values{true, true, true, true, true, true}));
+  EXPECT_EQ(a.masks()["x0"], x0);
+  EXPECT_EQ(a.masks()["x1"], x1);
+  EXPECT_EQ(a.masks()["xy"], xy);
+}
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "scipp/dataset/bins.h"
+#include "scipp/dataset/dataset.h"
+#include "scipp/dataset/quantile.h"
+#include "scipp/variable/bins.h"
+
+#include "test_macros.h"
+
+using namespace scipp;
+using namespace scipp::dataset;
+
+namespace {
+const auto NaN = std::numeric_limits<double>::quiet_NaN();
+}
+
+class QuantileTest : public ::testing::Test {
+protected:
+  Variable data =
+      makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3}, units::m,
+                           Values{1.0, 9.0, 2.0, 3.0, 4.0, 8.0});
+  Variable x = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  Variable y = makeVariable<double>(Dims{Dim::Y}, Shape{2}, Values{1, 2});
+  Variable mask =
+      makeVariable<bool>(Dims{Dim::X}, Shape{3}, Values{false, true, false});
+  DataArray a{data, {{Dim::X, x}, {Dim::Y, y}}, {{"mask", mask}}};
+};
+
+TEST_F(QuantileTest, median_applies_irreducible_mask) {
+  const auto result = median(a, Dim::X);
+  EXPECT_EQ(result.data(), makeVariable<double>(Dims{Dim::Y}, Shape{2},
+                                                units::m, Values{1.5, 5.5}));
+  EXPECT_EQ(result.coords(), (Coords(result.dims(), {{Dim::Y, y}})));
+  EXPECT_TRUE(result.masks().empty());
+}
+
+TEST_F(QuantileTest, median_keeps_reducible_mask) {
+  const auto result = median(a, Dim::Y);
+  EXPECT_EQ(result.data(),
+            makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m,
+                                 Values{2.0, 6.5, 5.0}));
+  EXPECT_EQ(result.masks()["mask"], mask);
+  EXPECT_EQ(result.coords()[Dim::X], x);
+}
+
+TEST_F(QuantileTest, quantile_all_dims) {
+  a.coords().set(Dim("scalar"), makeVariable<double>(Values{1.0}));
+  const auto result = quantile(a, 1.0);
+  EXPECT_EQ(result.data(), makeVariable<double>(units::m, Values{8.0}));
+  EXPECT_EQ(median(a).data(), makeVariable<double>(units::m, Values{2.5}));
+  EXPECT_EQ(result.coords(),
+            (Coords(Dimensions{},
+                    {{Dim("scalar"), makeVariable<double>(Values{1.0})}})));
+  EXPECT_TRUE(result.masks().empty());
+}
+
+TEST_F(QuantileTest, dataset) {
+  const Dataset d({{"a", a}, {"b", copy(a)}});
+  const auto result = median(d, Dim::X);
+  EXPECT_EQ(result["a"], median(a, Dim::X));
+  EXPECT_EQ(result["b"], median(a, Dim::X));
+}
+
+TEST_F(QuantileTest, nanmedian) {
+  a.data().values<double>()[3] = NaN;
+  EXPECT_TRUE(std::isnan(median(a, Dim::X).values<double>()[1]));
+  EXPECT_EQ(nanmedian(a, Dim::X).data(),
+            makeVariable<double>(Dims{Dim::Y}, Shape{2}, units::m,
+                                 Values{1.5, 8.0}));
+}
+
+class BinsQuantileTest : public ::testing::Test {
+protected:
+  Variable indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{3},
+      Values{std::pair{0, 3}, std::pair{3, 3}, std::pair{3, 7}});
+  Variable data = makeVariable<double>(
+      Dims{Dim::Event}, Shape{7}, units::K,
+      Values{3.0, 1.0, 2.0, 10.0, 40.0, 20.0, 30.0});
+  Variable event_mask = makeVariable<bool>(
+      Dims{Dim::Event}, Shape{7},
+      Values{false, false, true, false, false, false, true});
+};
+
+TEST_F(BinsQuantileTest, bins_median) {
+  const DataArray buffer(data, {{Dim::X, copy(data)}});
+  const auto binned = make_bins(indices, Dim::Event, buffer);
+  EXPECT_TRUE(equals_nan(bins_median(binned),
+                         makeVariable<double>(Dims{Dim::Y}, Shape{3}, units::K,
+                                              Values{2.0, NaN, 25.0})));
+  const auto q = bins_quantile(binned, 0.0);
+  EXPECT_EQ(q.slice({Dim::Y, 0}), makeVariable<double>(units::K, Values{1.0}));
+  EXPECT_EQ(q.slice({Dim::Y, 2}),
+            makeVariable<double>(units::K, Values{10.0}));
+}
+
+TEST_F(BinsQuantileTest, bins_median_ignores_masked_events) {
+  const DataArray buffer(data, {}, {{"mask", event_mask}});
+  const DataArray binned(make_bins(indices, Dim::Event, buffer),
+                         {{Dim::Y, makeVariable<double>(Dims{Dim::Y}, Shape{3},
+                                                        Values{1, 2, 3})}});
+  const auto result = bins_median(binned);
+  EXPECT_TRUE(equals_nan(result.data(),
+                         makeVariable<double>(Dims{Dim::Y}, Shape{3}, units::K,
+                                              Values{2.0, NaN, 20.0})));
+  EXPECT_EQ(result.coords(), binned.coords());
+}
+
+TEST_F(BinsQuantileTest, bins_of_variable) {
+  const auto binned = make_bins(indices, Dim::Event, data);
+  EXPECT_TRUE(equals_nan(bins_quantile(binned, 1.0),
+                         makeVariable<double>(Dims{Dim::Y}, Shape{3}, units::K,
+                                              Values{3.0, NaN, 40.0})));
+}
+
+TEST_F(BinsQuantileTest, bins_nanmedian) {
+  data.values<double>()[0] = NaN;
+  const auto binned = make_bins(indices, Dim::Event, data);
+  EXPECT_TRUE(std::isnan(bins_median(binned).values<double>()[0]));
+  EXPECT_EQ(bins_nanmedian(binned).slice({Dim::Y, 0}),
+            makeVariable<double>(units::K, Values{1.5}));
+}
+
+TEST_F(BinsQuantileTest, fail_dense) {
+  EXPECT_THROW_DISCARD(bins_median(data), except::TypeError);
+}
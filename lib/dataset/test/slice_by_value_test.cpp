@@ -354,3 +354,65 @@ TEST(SliceByValueTest, test_slice_range_on_single_edge_1D) {
   test(da);
   test(Dataset{da});
 }
+
+TEST(SliceByValueTest, test_point_on_sorted_point_coord_1D) {
+  auto ascending = make_points(1, 2, 3, 5, 8);
+  auto descending = make_points(8, 5, 3, 2, 1);
+  const auto test = [](const auto &sliceable, const scipp::index i3) {
+    EXPECT_EQ(slice(sliceable, Dim::X, 3.0 * units::s),
+              sliceable.slice({Dim::X, 2}));
+    EXPECT_EQ(slice(sliceable, Dim::X, 5.0 * units::s),
+              sliceable.slice({Dim::X, i3}));
+    EXPECT_THROW_DISCARD(slice(sliceable, Dim::X, 4.0 * units::s),
+                         except::SliceError);
+    EXPECT_THROW_DISCARD(slice(sliceable, Dim::X, 0.0 * units::s),
+                         except::SliceError);
+    EXPECT_THROW_DISCARD(slice(sliceable, Dim::X, 9.0 * units::s),
+                         except::SliceError);
+  };
+  test(ascending, 3);
+  test(Dataset{ascending}, 3);
+  test(descending, 1);
+  test(Dataset{descending}, 1);
+}
+
+TEST(SliceByValueTest, test_point_on_sorted_point_coord_1D_not_unique) {
+  auto da = make_points(1, 3, 3, 5);
+  EXPECT_EQ(slice(da, Dim::X, 5.0 * units::s), da.slice({Dim::X, 3}));
+  EXPECT_THROW_DISCARD(slice(da, Dim::X, 3.0 * units::s), except::SliceError);
+}
+
+TEST(SliceByValueTest, test_repeated_slicing_after_coord_modification) {
+  auto da = make_histogram(1, 2, 3, 4);
+  EXPECT_EQ(slice(da, Dim::X, 2.5 * units::s), da.slice({Dim::X, 1}));
+  auto coord = da.coords()[Dim::X];
+  coord.values<double>()[1] = 2.6;
+  EXPECT_EQ(slice(da, Dim::X, 2.5 * units::s), da.slice({Dim::X, 0}));
+  coord.values<double>()[1] = 5.0;
+  EXPECT_THROW_DISCARD(slice(da, Dim::X, 2.5 * units::s), std::runtime_error);
+}
+
+TEST(SliceByValueTest, test_datetime_coord) {
+  const auto t = [](const int64_t x) {
+    return makeVariable<core::time_point>(units::ns,
+                                          Values{core::time_point{x}});
+  };
+  const auto make = [](const scipp::index size, std::vector<int64_t> times) {
+    std::vector<core::time_point> values;
+    for (const auto x : times)
+      values.emplace_back(x);
+    return DataArray(makeVariable<double>(Dims{Dim::Time}, Shape{size}),
+                     {{Dim::Time,
+                       makeVariable<core::time_point>(
+                           Dims{Dim::Time}, Shape{values.size()}, units::ns,
+                           Values(values.begin(), values.end()))}});
+  };
+  const auto points = make(4, {10, 20, 30, 40});
+  EXPECT_EQ(slice(points, Dim::Time, t(30)), points.slice({Dim::Time, 2}));
+  EXPECT_EQ(slice(points, Dim::Time, t(15), t(35)),
+            points.slice({Dim::Time, 1, 3}));
+  const auto edges = make(3, {10, 20, 30, 40});
+  EXPECT_EQ(slice(edges, Dim::Time, t(25)), edges.slice({Dim::Time, 1}));
+  EXPECT_EQ(slice(edges, Dim::Time, t(15), t(35)),
+            edges.slice({Dim::Time, 0, 3}));
+}
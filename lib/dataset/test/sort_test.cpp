@@ -3,7 +3,12 @@
 #include "test_macros.h"
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <numeric>
+#include <random>
+
 #include "scipp/dataset/sort.h"
+#include "scipp/variable/shape.h"
 
 using namespace scipp;
 using namespace scipp::dataset;
@@ -92,6 +97,70 @@ TEST(SortTest, variable_1d_nan) {
   }
 }
 
+TEST(SortTest, variable_1d_is_stable) {
+  const auto var = makeVariable<int64_t>(Dims{Dim::X}, Shape{6},
+                                         Values{0, 1, 2, 3, 4, 5});
+  const auto key = makeVariable<double>(Dims{Dim::X}, Shape{6},
+                                        Values{2.0, 1.0, 2.0, -0.0, 1.0, 0.0});
+  EXPECT_EQ(sort(var, key), makeVariable<int64_t>(Dims{Dim::X}, Shape{6},
+                                                  Values{3, 5, 1, 4, 0, 2}));
+  EXPECT_EQ(sort(var, key, SortOrder::Descending),
+            makeVariable<int64_t>(Dims{Dim::X}, Shape{6},
+                                  Values{0, 2, 1, 4, 3, 5}));
+}
+
+TEST(SortTest, variable_1d_large_matches_stable_sort) {
+  // Large enough for multiple chunks of the radix sort.
+  const scipp::index size = 300000;
+  std::mt19937 gen(1234);
+  std::uniform_int_distribution<int64_t> dist(-1000000, 1000000);
+  std::vector<int64_t> keys(size);
+  for (auto &k : keys)
+    k = dist(gen);
+  std::vector<double> values(size);
+  std::iota(values.begin(), values.end(), 0.0);
+  std::vector<scipp::index> order(size);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&](auto a, auto b) { return keys[a] < keys[b]; });
+  std::vector<double> expected(size);
+  std::transform(order.begin(), order.end(), expected.begin(),
+                 [&](auto i) { return values[i]; });
+
+  const auto var =
+      makeVariable<double>(Dims{Dim::X}, Shape{size}, Values(values));
+  const auto key =
+      makeVariable<int64_t>(Dims{Dim::X}, Shape{size}, Values(keys));
+  EXPECT_EQ(sort(var, key), makeVariable<double>(Dims{Dim::X}, Shape{size},
+                                                 Values(expected)));
+}
+
+TEST(SortTest, variable_2d_transposed) {
+  const auto var = transpose(makeVariable<int>(Dims{Dim::Y, Dim::X},
+                                               Shape{2, 3}, units::m,
+                                               Values{1, 2, 3, 4, 5, 6}));
+  const auto key =
+      makeVariable<int>(Dims{Dim::X}, Shape{3}, Values{10, 20, -1});
+  EXPECT_EQ(sort(var, key),
+            transpose(makeVariable<int>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                        units::m, Values{3, 1, 2, 6, 4, 5})));
+}
+
+TEST(SortTest, variable_1d_string_and_time_point_keys) {
+  const auto var =
+      makeVariable<int64_t>(Dims{Dim::X}, Shape{3}, Values{0, 1, 2});
+  const auto expected =
+      makeVariable<int64_t>(Dims{Dim::X}, Shape{3}, Values{1, 2, 0});
+  EXPECT_EQ(sort(var, makeVariable<std::string>(Dims{Dim::X}, Shape{3},
+                                                Values{"c", "a", "b"})),
+            expected);
+  EXPECT_EQ(sort(var, makeVariable<core::time_point>(
+                          Dims{Dim::X}, Shape{3}, units::ns,
+                          Values{core::time_point{5}, core::time_point{-3},
+                                 core::time_point{2}})),
+            expected);
+}
+
 TEST(SortTest, data_array_1d) {
   Variable data = makeVariable<double>(
       Dims{Dim::Event}, Shape{4}, Values{1, 2, 3, 4}, Variances{1, 3, 2, 4});
@@ -196,3 +265,128 @@ TEST(SortTest, dataset_1d_descending) {
 
   EXPECT_EQ(sort(d, key, SortOrder::Descending), expected);
 }
+
+TEST(SortTest, variable_multi_key) {
+  const auto var =
+      makeVariable<double>(Dims{Dim::X}, Shape{5}, Values{1, 2, 3, 4, 5});
+  const auto key1 =
+      makeVariable<int64_t>(Dims{Dim::X}, Shape{5}, Values{1, 0, 1, 0, 1});
+  const auto key2 = makeVariable<double>(Dims{Dim::X}, Shape{5},
+                                         Values{2.0, 3.0, 1.0, -3.0, 2.0});
+  EXPECT_EQ(sort(var, std::vector{key1, key2}),
+            makeVariable<double>(Dims{Dim::X}, Shape{5},
+                                 Values{4, 2, 3, 1, 5}));
+  EXPECT_EQ(sort(var, std::vector{key2, key1}),
+            makeVariable<double>(Dims{Dim::X}, Shape{5},
+                                 Values{4, 3, 1, 5, 2}));
+  // Descending order is stable as well.
+  EXPECT_EQ(sort(var, std::vector{key1, key2}, SortOrder::Descending),
+            makeVariable<double>(Dims{Dim::X}, Shape{5},
+                                 Values{1, 5, 3, 2, 4}));
+}
+
+TEST(SortTest, variable_multi_key_single_key_matches_sort) {
+  const auto var =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1, 2, 3, 4});
+  const auto key =
+      makeVariable<float>(Dims{Dim::X}, Shape{4}, Values{2, -1, 2, 0});
+  EXPECT_EQ(sort(var, std::vector{key}), sort(var, key));
+  EXPECT_EQ(sort(var, std::vector{key}, SortOrder::Descending),
+            sort(var, key, SortOrder::Descending));
+}
+
+TEST(SortTest, variable_multi_key_string_and_float) {
+  const auto var =
+      makeVariable<int64_t>(Dims{Dim::X}, Shape{5}, Values{1, 2, 3, 4, 5});
+  const auto key1 = makeVariable<std::string>(
+      Dims{Dim::X}, Shape{5}, Values{"b", "a", "b", "a", "c"});
+  const auto key2 = makeVariable<float>(
+      Dims{Dim::X}, Shape{5}, Values{NAN, 1.0f, -0.0f, -2.0f, 0.0f});
+  EXPECT_EQ(sort(var, std::vector{key1, key2}),
+            makeVariable<int64_t>(Dims{Dim::X}, Shape{5},
+                                  Values{4, 2, 3, 1, 5}));
+}
+
+TEST(SortTest, variable_multi_key_full_range) {
+  // The combined range of the keys does not fit into 64 bits, so the keys
+  // have to be replaced by their ranks before packing.
+  constexpr auto min = std::numeric_limits<int64_t>::min();
+  constexpr auto max = std::numeric_limits<int64_t>::max();
+  const auto var =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1, 2, 3, 4});
+  const auto key1 = makeVariable<int64_t>(Dims{Dim::X}, Shape{4},
+                                          Values{max, min, max, min});
+  const auto key2 = makeVariable<int64_t>(Dims{Dim::X}, Shape{4},
+                                          Values{min, max, int64_t{0}, min});
+  const auto key3 =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1e300, 0.0, 0.0, 0.0});
+  EXPECT_EQ(sort(var, std::vector{key1, key2, key3}),
+            makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{4, 2, 1, 3}));
+  EXPECT_EQ(sort(var, std::vector{key2, key3, key1}),
+            makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{4, 1, 3, 2}));
+}
+
+TEST(SortTest, variable_multi_key_bad_keys) {
+  const auto var =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  const auto key = makeVariable<int64_t>(Dims{Dim::X}, Shape{3});
+  EXPECT_THROW(sort(var, std::vector<Variable>{}), std::invalid_argument);
+  EXPECT_THROW(sort(var, std::vector{key, makeVariable<int64_t>(
+                                              Dims{Dim::X}, Shape{2})}),
+               except::DimensionError);
+  EXPECT_THROW(sort(var, std::vector{key, makeVariable<int64_t>(
+                                              Dims{Dim::Y}, Shape{3})}),
+               except::DimensionError);
+  EXPECT_THROW(
+      sort(var, std::vector{key, makeVariable<int64_t>(Dims{Dim::X, Dim::Y},
+                                                       Shape{3, 1})}),
+      except::DimensionError);
+}
+
+TEST(SortTest, data_array_multi_key_by_coords) {
+  const auto data = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{4, 2},
+                                         Values{1, 2, 3, 4, 5, 6, 7, 8});
+  const auto a =
+      makeVariable<int32_t>(Dims{Dim::X}, Shape{4}, Values{2, 1, 2, 1});
+  const auto b =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{0.5, 0.3, 0.1, 0.4});
+  const DataArray da(data, {{Dim("a"), a}, {Dim("b"), b}},
+                     {{"mask", makeVariable<bool>(Dims{Dim::X}, Shape{4},
+                                                  Values{true, false, false,
+                                                         false})}});
+  const DataArray expected(
+      makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{4, 2},
+                           Values{3, 4, 7, 8, 5, 6, 1, 2}),
+      {{Dim("a"),
+        makeVariable<int32_t>(Dims{Dim::X}, Shape{4}, Values{1, 1, 2, 2})},
+       {Dim("b"), makeVariable<double>(Dims{Dim::X}, Shape{4},
+                                       Values{0.3, 0.4, 0.1, 0.5})}},
+      {{"mask", makeVariable<bool>(Dims{Dim::X}, Shape{4},
+                                   Values{false, false, false, true})}});
+  EXPECT_EQ(sort(da, std::vector{Dim("a"), Dim("b")}), expected);
+  EXPECT_EQ(sort(da, std::vector{a, b}), expected);
+}
+
+TEST(SortTest, dataset_multi_key_by_coords) {
+  Dataset d;
+  d.setData("a", makeVariable<float>(Dims{Dim::X}, Shape{3}, units::m,
+                                     Values{1, 2, 3}, Variances{4, 5, 6}));
+  d.setData("scalar", makeVariable<double>(Values{1.2}));
+  d.setCoord(Dim("k1"), makeVariable<int64_t>(Dims{Dim::X}, Shape{3},
+                                              Values{0, 0, -1}));
+  d.setCoord(Dim("k2"), makeVariable<std::string>(Dims{Dim::X}, Shape{3},
+                                                  Values{"y", "x", "z"}));
+
+  Dataset expected;
+  expected.setData("a",
+                   makeVariable<float>(Dims{Dim::X}, Shape{3}, units::m,
+                                       Values{3, 2, 1}, Variances{6, 5, 4}));
+  expected.setData("scalar", makeVariable<double>(Values{1.2}));
+  expected.setCoord(Dim("k1"), makeVariable<int64_t>(Dims{Dim::X}, Shape{3},
+                                                     Values{-1, 0, 0}));
+  expected.setCoord(Dim("k2"),
+                    makeVariable<std::string>(Dims{Dim::X}, Shape{3},
+                                              Values{"z", "x", "y"}));
+
+  EXPECT_EQ(sort(d, std::vector{Dim("k1"), Dim("k2")}), expected);
+}
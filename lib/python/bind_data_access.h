@@ -95,6 +95,9 @@ class DataAccessHelper {
       // no automatic move because of type mismatch
       return py::object{std::move(array)};
     } else {
+      // Writes via the returned array cannot be tracked, so properties of the
+      // data must not be cached anymore.
+      var.data_handle()->property_cache().disable();
       return py::array{get_dtype(), dims.shape(),
                        numpy_strides<T>(var.strides()),
                        Getter::template get<T>(view).data(),
@@ -214,6 +214,19 @@ void init_buckets(py::module &m) {
         return dataset::buckets::scale(array, histogram, Dim{dim});
       },
       py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "is_sorted_by",
+      [](const Variable &var, const std::string &dim) {
+        return dataset::buckets::is_sorted_by(var, Dim{dim});
+      },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "slice_sorted",
+      [](const Variable &var, const std::string &dim, const Variable &begin,
+         const Variable &end) {
+        return dataset::buckets::slice_sorted(var, Dim{dim}, begin, end);
+      },
+      py::call_guard<py::gil_scoped_release>());
 
   m.def(
       "bin",
@@ -45,6 +45,17 @@ template <class T> void bind_groupby(py::module &m, const std::string &name) {
       py::arg("data"), py::arg("group"),
       py::call_guard<py::gil_scoped_release>());
 
+  m.def(
+      "groupby",
+      [](const T &x, const std::vector<std::string> &dims) {
+        std::vector<Dim> keys;
+        for (const auto &dim : dims)
+          keys.emplace_back(dim);
+        return groupby(x, keys);
+      },
+      py::arg("data"), py::arg("group"),
+      py::call_guard<py::gil_scoped_release>());
+
   m.def(
       "groupby",
       [](const T &x, const std::string &dim, const Variable &bins) {
@@ -5,9 +5,11 @@
 #include "pybind11.h"
 
 #include "scipp/dataset/dataset.h"
+#include "scipp/dataset/quantile.h"
 #include "scipp/dataset/sort.h"
 #include "scipp/variable/math.h"
 #include "scipp/variable/operations.h"
+#include "scipp/variable/quantile.h"
 #include "scipp/variable/slice.h"
 #include "scipp/variable/sort.h"
 #include "scipp/variable/util.h"
@@ -41,6 +43,14 @@ template <typename T> void bind_sort(py::module &m) {
       },
       py::arg("x"), py::arg("key"), py::arg("order"),
       py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "sort",
+      [](const T &x, const std::vector<Variable> &keys,
+         const std::string &order) {
+        return sort(x, keys, get_sort_order(order));
+      },
+      py::arg("x"), py::arg("key"), py::arg("order"),
+      py::call_guard<py::gil_scoped_release>());
 }
 
 template <typename T> void bind_sort_dim(py::module &m) {
@@ -53,6 +63,20 @@ template <typename T> void bind_sort_dim(py::module &m) {
       py::call_guard<py::gil_scoped_release>());
 }
 
+template <typename T> void bind_sort_dims(py::module &m) {
+  m.def(
+      "sort",
+      [](const T &x, const std::vector<std::string> &dims,
+         const std::string &order) {
+        std::vector<Dim> keys;
+        for (const auto &dim : dims)
+          keys.emplace_back(dim);
+        return sort(x, keys, get_sort_order(order));
+      },
+      py::arg("x"), py::arg("key"), py::arg("order"),
+      py::call_guard<py::gil_scoped_release>());
+}
+
 void bind_issorted(py::module &m) {
   m.def(
       "issorted",
@@ -80,6 +104,61 @@ void bind_midpoints(py::module &m) {
   });
 }
 
+template <typename T> void bind_quantile(py::module &m) {
+  m.def(
+      "median", [](const T &x) { return median(x); }, py::arg("x"),
+      py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "median",
+      [](const T &x, const std::string &dim) { return median(x, Dim{dim}); },
+      py::arg("x"), py::arg("dim"), py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "nanmedian", [](const T &x) { return nanmedian(x); }, py::arg("x"),
+      py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "nanmedian",
+      [](const T &x, const std::string &dim) { return nanmedian(x, Dim{dim}); },
+      py::arg("x"), py::arg("dim"), py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "quantile", [](const T &x, const double q) { return quantile(x, q); },
+      py::arg("x"), py::arg("q"), py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "quantile",
+      [](const T &x, const double q, const std::string &dim) {
+        return quantile(x, Dim{dim}, q);
+      },
+      py::arg("x"), py::arg("q"), py::arg("dim"),
+      py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "nanquantile",
+      [](const T &x, const double q) { return nanquantile(x, q); },
+      py::arg("x"), py::arg("q"), py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "nanquantile",
+      [](const T &x, const double q, const std::string &dim) {
+        return nanquantile(x, Dim{dim}, q);
+      },
+      py::arg("x"), py::arg("q"), py::arg("dim"),
+      py::call_guard<py::gil_scoped_release>());
+}
+
+template <typename T> void bind_bins_quantile(py::module &m) {
+  m.def(
+      "bins_median", [](const T &x) { return bins_median(x); }, py::arg("x"),
+      py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "bins_nanmedian", [](const T &x) { return bins_nanmedian(x); },
+      py::arg("x"), py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "bins_quantile",
+      [](const T &x, const double q) { return bins_quantile(x, q); },
+      py::arg("x"), py::arg("q"), py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "bins_nanquantile",
+      [](const T &x, const double q) { return bins_nanquantile(x, q); },
+      py::arg("x"), py::arg("q"), py::call_guard<py::gil_scoped_release>());
+}
+
 void init_operations(py::module &m) {
   bind_dot<Variable>(m);
 
@@ -89,9 +168,16 @@ void init_operations(py::module &m) {
   bind_sort_dim<Variable>(m);
   bind_sort_dim<DataArray>(m);
   bind_sort_dim<Dataset>(m);
+  bind_sort_dims<DataArray>(m);
+  bind_sort_dims<Dataset>(m);
   bind_issorted(m);
   bind_allsorted(m);
   bind_midpoints(m);
+  bind_quantile<Variable>(m);
+  bind_quantile<DataArray>(m);
+  bind_quantile<Dataset>(m);
+  bind_bins_quantile<Variable>(m);
+  bind_bins_quantile<DataArray>(m);
 
   m.def(
       "get_slice_params",
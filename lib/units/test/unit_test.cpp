@@ -2,6 +2,9 @@
 // Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
 #include "test_macros.h"
 
 #include "scipp/units/except.h"
@@ -329,3 +332,36 @@ TEST(UnitTest, sqrt_of_none_returns_none) {
 TEST(UnitTest, pow_of_none_returns_none) {
   EXPECT_EQ(sqrt(units::none), units::none);
 }
+
+TEST(UnitParseTest, repeated_parse_and_format) {
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(Unit("m/s"), units::m / units::s);
+    EXPECT_EQ(Unit("month").name(), "M");
+    EXPECT_THROW_DISCARD(Unit("abcdef"), except::UnitError);
+  }
+}
+
+TEST(UnitParseTest, aliases_invalidate_cached_parse_and_format) {
+  const auto unit = units::K * units::s;
+  const auto name = unit.name();
+  EXPECT_THROW_DISCARD(Unit("clucks"), except::UnitError);
+  units::add_unit_alias("clucks", unit);
+  EXPECT_EQ(Unit("clucks"), unit);
+  EXPECT_EQ(unit.name(), "clucks");
+  units::clear_unit_aliases();
+  EXPECT_EQ(unit.name(), name);
+  EXPECT_THROW_DISCARD(Unit("clucks"), except::UnitError);
+}
+
+TEST(UnitParseTest, concurrent_parse_and_format) {
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back([]() {
+      for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(Unit("m/s"), units::m / units::s);
+        EXPECT_EQ(Unit("month").name(), "M");
+      }
+    });
+  for (auto &thread : threads)
+    thread.join();
+}
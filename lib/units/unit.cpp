@@ -3,8 +3,12 @@
 /// @file
 /// @author Simon Heybrock
 /// @author Neil Vaytet
+#include <mutex>
 #include <regex>
+#include <shared_mutex>
 #include <stdexcept>
+#include <unordered_map>
+#include <vector>
 
 #include <units/units.hpp>
 #include <units/units_util.hpp>
@@ -37,27 +41,120 @@ bool is_special_unit(const llnl::units::precise_unit &unit) {
 }
 } // namespace
 
-Unit::Unit(const std::string &unit)
-    : Unit(llnl::units::unit_from_string(map_unit_string(unit),
-                                         llnl::units::strict_si)) {
-  if (const auto &u = m_unit.value(); is_special_unit(u) || !is_valid(u))
-    throw except::UnitError("Failed to convert string `" + unit +
+namespace {
+/// Thread-safe cache of parsed unit strings and formatted unit names.
+///
+/// Parsing and formatting units is slow compared to most operations with
+/// units, but a program typically uses few distinct units. Both caches are
+/// bounded and cleared when unit aliases change since aliases affect parsing
+/// as well as formatting.
+class UnitCache {
+public:
+  using Generation = std::size_t;
+
+  Generation generation() const {
+    std::shared_lock lock(m_mutex);
+    return m_generation;
+  }
+
+  std::optional<Unit> parsed(const std::string &str) const {
+    std::shared_lock lock(m_mutex);
+    if (const auto it = m_parsed.find(str); it != m_parsed.end())
+      return it->second;
+    return std::nullopt;
+  }
+
+  void add_parsed(const std::string &str, const Unit &unit,
+                  const Generation generation) {
+    std::unique_lock lock(m_mutex);
+    if (generation == m_generation && m_parsed.size() < max_parsed)
+      m_parsed.emplace(str, unit);
+  }
+
+  std::optional<std::string> name(const Unit &unit) const {
+    std::shared_lock lock(m_mutex);
+    // Exact comparison since operator== of units has a tolerance.
+    for (const auto &[u, name] : m_names)
+      if (identical(u, unit))
+        return name;
+    return std::nullopt;
+  }
+
+  void add_name(const Unit &unit, const std::string &name,
+                const Generation generation) {
+    std::unique_lock lock(m_mutex);
+    if (generation == m_generation && m_names.size() < max_names)
+      m_names.emplace_back(unit, name);
+  }
+
+  void clear() {
+    std::unique_lock lock(m_mutex);
+    ++m_generation;
+    m_parsed.clear();
+    m_names.clear();
+  }
+
+private:
+  static constexpr std::size_t max_parsed = 1024;
+  // Names are searched linearly, so keep this small.
+  static constexpr std::size_t max_names = 64;
+  mutable std::shared_mutex m_mutex;
+  Generation m_generation{0};
+  std::unordered_map<std::string, Unit> m_parsed;
+  std::vector<std::pair<Unit, std::string>> m_names;
+};
+
+UnitCache &unit_cache() {
+  static UnitCache cache;
+  return cache;
+}
+
+Unit parse(const std::string &str) {
+  auto &cache = unit_cache();
+  if (const auto unit = cache.parsed(str))
+    return *unit;
+  const auto generation = cache.generation();
+  const auto u = llnl::units::unit_from_string(map_unit_string(str),
+                                               llnl::units::strict_si);
+  if (is_special_unit(u) || !is_valid(u))
+    throw except::UnitError("Failed to convert string `" + str +
                             "` to valid unit.");
+  const Unit unit(u);
+  cache.add_parsed(str, unit, generation);
+  return unit;
+}
+
+std::string format(const llnl::units::precise_unit &unit) {
+  static const Unit month("month");
+  if (Unit(unit) == month)
+    return "M";
+  static const std::regex micro("^u");
+  static const std::regex item("item");
+  static const std::regex count("count(?!s)");
+  static const std::regex day("day");
+  static const std::regex year("a_g");
+  auto repr = to_string(unit);
+  repr = std::regex_replace(repr, micro, "µ");
+  repr = std::regex_replace(repr, item, "count");
+  repr = std::regex_replace(repr, count, "counts");
+  repr = std::regex_replace(repr, day, "D");
+  repr = std::regex_replace(repr, year, "Y");
+  return repr.empty() ? "dimensionless" : repr;
 }
+} // namespace
+
+Unit::Unit(const std::string &unit) : Unit(parse(unit)) {}
 
 std::string Unit::name() const {
   if (!has_value())
     return "None";
-  if (*this == Unit{"month"}) {
-    return "M";
-  }
-  auto repr = to_string(*m_unit);
-  repr = std::regex_replace(repr, std::regex("^u"), "µ");
-  repr = std::regex_replace(repr, std::regex("item"), "count");
-  repr = std::regex_replace(repr, std::regex("count(?!s)"), "counts");
-  repr = std::regex_replace(repr, std::regex("day"), "D");
-  repr = std::regex_replace(repr, std::regex("a_g"), "Y");
-  return repr.empty() ? "dimensionless" : repr;
+  auto &cache = unit_cache();
+  if (auto name = cache.name(*this))
+    return *std::move(name);
+  const auto generation = cache.generation();
+  auto name = format(*m_unit);
+  cache.add_name(*this, name, generation);
+  return name;
 }
 
 bool Unit::isCounts() const { return *this == counts; }
@@ -202,8 +299,12 @@ bool identical(const Unit &a, const Unit &b) {
 
 void add_unit_alias(const std::string &name, const Unit &unit) {
   llnl::units::addUserDefinedUnit(name, unit.underlying());
+  unit_cache().clear();
 }
 
-void clear_unit_aliases() { llnl::units::clearUserDefinedUnits(); }
+void clear_unit_aliases() {
+  llnl::units::clearUserDefinedUnits();
+  unit_cache().clear();
+}
 
 } // namespace scipp::units
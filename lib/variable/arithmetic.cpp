@@ -1,11 +1,15 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <optional>
+
 #include "scipp/variable/arithmetic.h"
 #include "scipp/core/dtype.h"
 #include "scipp/core/eigen.h"
 #include "scipp/core/element/arithmetic.h"
+#include "scipp/core/planar.h"
 #include "scipp/core/spatial_transforms.h"
 #include "scipp/variable/astype.h"
+#include "scipp/variable/creation.h"
 #include "scipp/variable/pow.h"
 #include "scipp/variable/transform.h"
 #include "scipp/variable/variable_factory.h"
@@ -19,6 +23,62 @@ bool is_transform_with_translation(const Variable &var) {
          var.dtype() == dtype<scipp::core::Translation>;
 }
 
+template <class T> bool is_scalar_transform(const Variable &var) {
+  return var.dtype() == dtype<T> && var.dims().ndim() == 0 &&
+         !var.has_variances();
+}
+
+std::optional<std::pair<Eigen::Matrix3d, Eigen::Vector3d>>
+scalar_linear_and_translation(const Variable &var) {
+  if (is_scalar_transform<Eigen::Matrix3d>(var))
+    return core::linear_and_translation(var.value<Eigen::Matrix3d>());
+  if (is_scalar_transform<Eigen::Affine3d>(var))
+    return core::linear_and_translation(var.value<Eigen::Affine3d>());
+  if (is_scalar_transform<core::Quaternion>(var))
+    return core::linear_and_translation(var.value<core::Quaternion>());
+  if (is_scalar_transform<core::Translation>(var))
+    return core::linear_and_translation(var.value<core::Translation>());
+  return std::nullopt;
+}
+
+bool is_contiguous_vectors(const Variable &var) {
+  return var.dtype() == dtype<Eigen::Vector3d> && !var.has_variances() &&
+         Strides(var.strides()) == Strides(var.dims());
+}
+
+/// Apply a 0-D spatial transform to contiguous vectors in a single pass.
+///
+/// This bypasses the generic element-wise transform, which would multiply
+/// every vector by the full Eigen type. Instead, the transform is decomposed
+/// once into scalar coefficients and applied to blocks of vectors.
+std::optional<Variable> apply_scalar_spatial_transformation(const Variable &a,
+                                                            const Variable &b) {
+  if (!is_contiguous_vectors(b))
+    return std::nullopt;
+  const auto coefficients = scalar_linear_and_translation(a);
+  if (!coefficients)
+    return std::nullopt;
+  // Same unit handling as element::apply_spatial_transformation and multiply.
+  if (is_transform_with_translation(a) && a.unit() != b.unit())
+    throw except::UnitError(
+        "Cannot apply spatial transform as the units of the transformation "
+        "are not the same as the units of transformation or vector.");
+  const auto unit =
+      is_transform_with_translation(a) ? b.unit() : a.unit() * b.unit();
+  auto out = empty(b.dims(), unit, dtype<Eigen::Vector3d>);
+  const auto *in =
+      reinterpret_cast<const double *>(b.values<Eigen::Vector3d>().data());
+  auto *result =
+      reinterpret_cast<double *>(out.values<Eigen::Vector3d>().data());
+  core::planar::for_each_block(
+      b.dims().volume(), [&](const auto begin, const auto end) {
+        core::planar::apply_interleaved(coefficients->first,
+                                        coefficients->second, in, result, begin,
+                                        end);
+      });
+  return out;
+}
+
 auto make_factor(const Variable &prototype, const double value) {
   const auto unit = variableFactory().elem_unit(prototype) == units::none
                         ? units::none
@@ -48,6 +108,8 @@ Variable operator-(const Variable &a, const Variable &b) {
 }
 
 Variable operator*(const Variable &a, const Variable &b) {
+  if (auto out = apply_scalar_spatial_transformation(a, b))
+    return std::move(*out);
   if (is_transform_with_translation(a) &&
       (is_transform_with_translation(b) ||
        b.dtype() == dtype<Eigen::Vector3d>)) {
@@ -27,7 +27,8 @@ static void do_accumulate(const std::tuple<Ts...> &types, Op op,
       (sizeof...(other) != 1 && var.dims().ndim() == 0))
     return in_place<false>::transform_data(types, op, name, var, other...);
 
-  const auto reduce_chunk = [&](auto &&out, const Slice &slice) {
+  const auto reduce_chunk = [&](auto &&out, const Slice &slice,
+                                const auto &...in) {
     // A typical cache line has 64 Byte, which would fit, e.g., 8 doubles. If
     // multiple threads write to different elements in the same cache lines we
     // have "false sharing", with a severe negative performance impact. 128 is a
@@ -38,25 +39,36 @@ static void do_accumulate(const std::tuple<Ts...> &types, Op op,
     auto tmp = avoid_false_sharing ? copy(out) : out;
     [&](const auto &...args) { // force slices to const, avoid readonly issues
       in_place<false>::transform_data(types, op, name, tmp, args...);
-    }(other.slice(slice)...);
+    }(in.slice(slice)...);
     if (avoid_false_sharing)
       copy(tmp, out);
   };
 
-  // TODO The parallelism could be improved for cases where the output has more
-  // than one dimension, e.g., by flattening the output's dims in all inputs.
-  // However, it is nontrivial to detect whether calling `flatten` on `other` is
-  // possible without copies so this is not implemented at this point.
-  const auto accumulate_parallel = [&]() {
-    const auto dim = *var.dims().begin();
+  const auto parallel_over_outer_dim = [&](auto &&out, const auto &...in) {
+    const auto dim = *out.dims().begin();
     const auto reduce = [&](const auto &range) {
       const Slice slice(dim, range.begin(), range.end());
-      reduce_chunk(var.slice(slice), slice);
+      reduce_chunk(out.slice(slice), slice, in...);
     };
-    const auto size = var.dims()[dim];
+    const auto size = out.dims()[dim];
     core::parallel::parallel_for(core::parallel::blocked_range(0, size),
                                  reduce);
   };
+  // If the output has more than one dimension, flattening the output's dims
+  // in the output and all inputs improves parallelism, e.g., if the outer
+  // dimension is short. This is done only if flattening requires no copies.
+  const auto accumulate_parallel = [&]() {
+    const auto labels = var.dims().labels();
+    if (var.dims().ndim() > 1 && can_flatten_without_copy(var, labels) &&
+        (can_flatten_without_copy(other, labels) && ...)) {
+      const auto flat = [&labels](const Variable &x) {
+        return flatten(x, labels, Dim::InternalAccumulate);
+      };
+      parallel_over_outer_dim(flat(var), flat(other)...);
+    } else {
+      parallel_over_outer_dim(var, other...);
+    }
+  };
   if constexpr (sizeof...(other) == 1) {
     const bool reduce_outer =
         (!var.dims().contains(other.dims().labels().front()) || ...);
@@ -89,13 +101,16 @@ static void do_accumulate(const std::tuple<Ts...> &types, Op op,
       auto v = copy(var);
       if (in_place<false>::transform_data(types, op, name, v, var); var != v)
         return in_place<false>::transform_data(types, op, name, var, other...);
+      // Each chunk writes to its own slice concurrently, so this cannot be a
+      // (read-only) broadcast view but must be a unique buffer.
       v = copy(
           broadcast(var, merge({Dim::InternalAccumulate, nchunk}, var.dims())));
       const auto reduce = [&](const auto &range) {
         for (scipp::index i = range.begin(); i < range.end(); ++i) {
           const Slice slice(outer_dim, std::min(i * chunk_size, outer_size),
                             std::min((i + 1) * chunk_size, outer_size));
-          reduce_chunk(v.slice({Dim::InternalAccumulate, i}), slice);
+          reduce_chunk(v.slice({Dim::InternalAccumulate, i}), slice,
+                       other...);
         }
       };
       core::parallel::parallel_for(core::parallel::blocked_range(0, nchunk, 1),
@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <string>
+
+#include "scipp-variable_export.h"
+#include "scipp/variable/variable.h"
+
+/// Operations on vectors and matrices stored in planar (structure-of-arrays)
+/// layout.
+///
+/// A planar variable is a variable of dtype double with an outer dimension
+/// Dim::InternalStructureComponent. Each slice along this dimension is a
+/// contiguous plane holding one field of the structure, in the order given by
+/// `element_keys`. Field access is therefore a zero-cost contiguous view and
+/// operations on planar vectors can be vectorized by the compiler.
+namespace scipp::variable::planar {
+
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable to_planar(const Variable &var);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable from_planar(const Variable &planes,
+                                                         const DType type);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable field(const Variable &planes,
+                                                   const std::string &key);
+
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable dot(const Variable &a,
+                                                 const Variable &b);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable cross(const Variable &a,
+                                                   const Variable &b);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable norm(const Variable &a);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable apply(const Variable &transform,
+                                                   const Variable &vectors);
+
+} // namespace scipp::variable::planar
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "scipp-variable_export.h"
+#include "scipp/common/index.h"
+#include "scipp/core/dimensions.h"
+#include "scipp/core/strides.h"
+
+namespace scipp::variable {
+
+class Variable;
+
+/// Properties of the values of a variable along a dimension, which are
+/// expensive to compute but can be cached.
+enum class CachedProperty {
+  SortedAscending,
+  SortedDescending,
+  Linspace,
+  SortedWithinBins
+};
+
+/// Cache of properties of the data held by a VariableConcept.
+///
+/// Entries refer to the view of the data given by a variable's offset, dims,
+/// and strides, and are cleared whenever the data may be modified, i.e., on
+/// every non-const access via Variable::data(). Copies start with an empty
+/// cache. The cache can be disabled permanently, e.g., when a writable
+/// reference to the data is handed out to code we do not control.
+///
+/// Generations are unique across all caches, so a property depending on other
+/// data can be stored with the generation of that data's cache as `context`.
+class SCIPP_VARIABLE_EXPORT PropertyCache {
+public:
+  /// Identifies the state of the data for which a cached value is computed.
+  using Generation = scipp::index;
+
+  PropertyCache() noexcept;
+  PropertyCache(const PropertyCache &) noexcept;
+  PropertyCache &operator=(const PropertyCache &) noexcept;
+
+  [[nodiscard]] std::optional<bool> get(const Variable &var,
+                                        CachedProperty property, Dim dim,
+                                        Generation context = 0) const;
+  [[nodiscard]] Generation generation() const noexcept;
+  void set(const Variable &var, CachedProperty property, Dim dim, bool value,
+           Generation generation, Generation context = 0);
+  void clear() noexcept;
+  void disable() noexcept;
+
+private:
+  struct Entry {
+    CachedProperty property;
+    Dim dim;
+    scipp::index offset;
+    Dimensions dims;
+    Strides strides;
+    Generation context;
+    bool value;
+  };
+  mutable std::mutex m_mutex;
+  Generation m_generation;
+  bool m_enabled{true};
+  std::vector<Entry> m_entries;
+};
+
+} // namespace scipp::variable
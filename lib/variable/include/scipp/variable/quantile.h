@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include "scipp-variable_export.h"
+#include "scipp/variable/variable.h"
+
+namespace scipp::variable {
+
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+quantile(const Variable &var, const Dim dim, const double q);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable quantile(const Variable &var,
+                                                      const double q);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+nanquantile(const Variable &var, const Dim dim, const double q);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nanquantile(const Variable &var,
+                                                         const double q);
+
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable median(const Variable &var,
+                                                    const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable median(const Variable &var);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nanmedian(const Variable &var,
+                                                       const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nanmedian(const Variable &var);
+
+// Helpers for quantiles of masked data and of bins.
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+quantile_impl(const Variable &var, const Dim dim, const double q,
+              const bool skip_nan, const Variable &mask = {});
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+subspan_quantile(const Variable &values, const Variable &mask, const double q,
+                 const bool skip_nan);
+
+} // namespace scipp::variable
@@ -23,6 +23,9 @@ resize(const Variable &var, const Dim dim, const scipp::index size,
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable fold(const Variable &view,
                                                   const Dim from_dim,
                                                   const Dimensions &to_dims);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT bool
+can_flatten_without_copy(const Variable &var,
+                         const scipp::span<const Dim> &from_labels);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
 flatten(const Variable &view, const scipp::span<const Dim> &from_labels,
         const Dim to_dim);
@@ -15,4 +15,7 @@ namespace scipp::variable {
 to_unit(const Variable &var, const units::Unit &unit,
         CopyPolicy copy = CopyPolicy::Always);
 
+[[nodiscard]] SCIPP_VARIABLE_EXPORT double
+to_unit_scale(const units::Unit &from, const units::Unit &to);
+
 } // namespace scipp::variable
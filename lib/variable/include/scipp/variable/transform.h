@@ -189,6 +189,61 @@ static constexpr void call_in_place(Op &&op, const Indices &indices, Arg &&arg,
     arg.variances.data()[i] = arg_.variance;
   }
 }
+
+/// Return pointers to the values and, if present, the variances of an operand
+/// at index `i`, for use by kernels for contiguous arrays.
+template <class T>
+static constexpr auto contiguous_pointers(T &&operand, const scipp::index i) {
+  if constexpr (has_variances_v<std::decay_t<T>>)
+    return std::tuple(operand.values.data() + i, operand.variances.data() + i);
+  else
+    return std::tuple(operand.data() + i);
+}
+
+template <class Op, class Pointers, class = void>
+struct has_contiguous_kernel : std::false_type {};
+template <class Op, class... Pointers>
+struct has_contiguous_kernel<
+    Op, std::tuple<Pointers...>,
+    std::void_t<decltype(std::declval<const Op &>().contiguous(
+        std::declval<Pointers>()..., scipp::index{}))>> : std::true_type {};
+/// True if `Op` has a kernel for contiguous operands, see
+/// core::contiguous_unary.
+template <class Op, class... Operands>
+inline constexpr bool has_contiguous_kernel_v = has_contiguous_kernel<
+    std::decay_t<Op>, decltype(std::tuple_cat(contiguous_pointers(
+                          std::declval<Operands &>(), 0)...))>::value;
+
+template <class Op, class Pointers, class = void>
+struct has_reduce_kernel : std::false_type {};
+template <class Op, class... Pointers>
+struct has_reduce_kernel<
+    Op, std::tuple<Pointers...>,
+    std::void_t<decltype(std::declval<const Op &>().reduce(
+        std::declval<Pointers>()..., scipp::index{}))>> : std::true_type {};
+/// True if `Op` has a kernel for reducing contiguous operands into a single
+/// element, see core::contiguous_reduce.
+template <class Op, class... Operands>
+inline constexpr bool has_reduce_kernel_v = has_reduce_kernel<
+    std::decay_t<Op>, decltype(std::tuple_cat(contiguous_pointers(
+                          std::declval<Operands &>(), 0)...))>::value;
+
+/// True if the output is a single element and all inputs are contiguous.
+template <scipp::index Out, scipp::index... In>
+inline constexpr bool is_reduce_strides = Out == 0 && ((In == 1) && ...);
+
+/// Call `kernel` with pointers to the values and variances of all operands at
+/// their current indices, followed by the length `n` of the inner loop.
+template <class Kernel, size_t N, class... Operands, size_t... I>
+static void call_kernel(const Kernel &kernel,
+                        const std::array<scipp::index, N> &indices,
+                        const scipp::index n, std::index_sequence<I...>,
+                        Operands &&...operands) {
+  std::apply(
+      [&kernel, n](const auto... pointers) { kernel(pointers..., n); },
+      std::tuple_cat(contiguous_pointers(operands, indices[I])...));
+}
+
 /// Run transform with strides known at compile time.
 template <bool in_place, class Op, class... Operands, scipp::index... Strides>
 static void inner_loop(Op &&op,
@@ -197,13 +252,24 @@ static void inner_loop(Op &&op,
                        const scipp::index n, Operands &&...operands) {
   static_assert(sizeof...(Operands) == sizeof...(Strides));
 
-  for (scipp::index i = 0; i < n; ++i) {
-    if constexpr (in_place) {
-      detail::call_in_place(op, indices, std::forward<Operands>(operands)...);
-    } else {
-      detail::call(op, indices, std::forward<Operands>(operands)...);
+  if constexpr (((Strides == 1) && ...) &&
+                has_contiguous_kernel_v<Op, Operands...>) {
+    call_kernel([&op](const auto... args) { op.contiguous(args...); }, indices,
+                n, std::index_sequence_for<Operands...>{}, operands...);
+  } else if constexpr (in_place && is_reduce_strides<Strides...> &&
+                       has_reduce_kernel_v<Op, Operands...>) {
+    call_kernel([&op](const auto... args) { op.reduce(args...); }, indices, n,
+                std::index_sequence_for<Operands...>{}, operands...);
+  } else {
+    for (scipp::index i = 0; i < n; ++i) {
+      if constexpr (in_place) {
+        detail::call_in_place(op, indices,
+                              std::forward<Operands>(operands)...);
+      } else {
+        detail::call(op, indices, std::forward<Operands>(operands)...);
+      }
+      detail::increment<Strides...>(indices);
     }
-    detail::increment<Strides...>(indices);
   }
 }
 
@@ -248,6 +314,13 @@ static void dispatch_inner_loop(
   }
 }
 
+/// Arrays of dense data up to this size are processed on the calling thread.
+///
+/// For small arrays the cost of scheduling tasks with TBB exceeds the cost of
+/// the actual operation. This does not apply to binned data since the work per
+/// bin is unknown.
+constexpr scipp::index serial_size_threshold = 1024;
+
 template <class Op, class Out, class... Ts>
 static void transform_elements(Op op, Out &&out, Ts &&...other) {
   const auto begin =
@@ -267,6 +340,13 @@ static void transform_elements(Op op, Out &&out, Ts &&...other) {
     }
   };
 
+  if (!begin.has_bins() && out.size() <= serial_size_threshold) {
+    auto indices = begin;
+    auto end = begin;
+    end.set_index(out.size());
+    run(indices, end);
+    return;
+  }
   auto run_parallel = [&](const auto &range) {
     auto indices = begin;
     indices.set_index(range.begin());
@@ -274,8 +354,16 @@ static void transform_elements(Op op, Out &&out, Ts &&...other) {
     end.set_index(range.end());
     run(indices, end);
   };
-  core::parallel::parallel_for(core::parallel::blocked_range(0, out.size()),
-                               run_parallel);
+  if (begin.has_bins()) {
+    core::parallel::parallel_for(core::parallel::blocked_range(0, out.size()),
+                                 run_parallel);
+  } else {
+    // Same partitioning as the first touch of the output buffer in
+    // element_array, so each thread writes to memory on its own NUMA node.
+    core::parallel::parallel_for(core::parallel::blocked_range(0, out.size()),
+                                 run_parallel,
+                                 core::parallel::static_partitioner{});
+  }
 }
 
 template <class T> static constexpr auto maybe_eval(T &&_) {
@@ -506,9 +594,11 @@ template <bool dry_run> struct in_place {
         indices.increment_by(inner_size != 0 ? inner_size : 1);
       }
     };
-    if (begin.has_stride_zero()) {
+    if (begin.has_stride_zero() ||
+        (!begin.has_bins() && arg.size() <= detail::serial_size_threshold)) {
       // The output has a dimension with stride zero so parallelization must
-      // be done differently. See parallelization in accumulate.h.
+      // be done differently. See parallelization in accumulate.h. Small
+      // arrays are not worth parallelizing.
       auto indices = begin;
       auto end = begin;
       end.set_index(arg.size());
@@ -521,8 +611,13 @@ template <bool dry_run> struct in_place {
         end.set_index(range.end());
         run(indices, end);
       };
-      core::parallel::parallel_for(core::parallel::blocked_range(0, arg.size()),
-                                   run_parallel);
+      if (begin.has_bins())
+        core::parallel::parallel_for(
+            core::parallel::blocked_range(0, arg.size()), run_parallel);
+      else
+        core::parallel::parallel_for(
+            core::parallel::blocked_range(0, arg.size()), run_parallel,
+            core::parallel::static_partitioner{});
     }
   }
 
@@ -20,6 +20,9 @@ namespace scipp::variable {
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable islinspace(const Variable &var,
                                                         const Dim dim);
 
+[[nodiscard]] SCIPP_VARIABLE_EXPORT bool alllinspace(const Variable &var,
+                                                     const Dim dim);
+
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
 issorted(const Variable &x, const Dim dim,
          const SortOrder order = SortOrder::Ascending);
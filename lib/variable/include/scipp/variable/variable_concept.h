@@ -9,6 +9,7 @@
 #include "scipp/core/dimensions.h"
 #include "scipp/core/dtype.h"
 #include "scipp/units/unit.h"
+#include "scipp/variable/property_cache.h"
 
 #include <memory>
 
@@ -60,10 +61,14 @@ public:
 
   virtual const VariableConceptHandle &bin_indices() const = 0;
 
+  /// Cached properties of the data, such as sortedness along a dimension.
+  PropertyCache &property_cache() const noexcept { return m_property_cache; }
+
   friend class Variable;
 
 private:
   units::Unit m_unit;
+  mutable PropertyCache m_property_cache;
 };
 
 } // namespace scipp::variable
@@ -4,6 +4,7 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include <array>
 #include <tuple>
 #include <utility>
 #include <variant>
@@ -37,9 +38,10 @@ template <class T, class Var> auto variable_access(Var &var) {
 
 namespace visit_detail {
 
-template <template <class...> class Tuple, class... T, class... V>
-static bool holds_alternatives(Tuple<T...> &&, const V &...v) noexcept {
-  return ((dtype<T> == variableFactory().elem_dtype(v)) && ...);
+template <template <class...> class Tuple, class... T>
+static bool holds_alternatives(
+    Tuple<T...> &&, const std::array<DType, sizeof...(T)> &dtypes) noexcept {
+  return std::array<DType, sizeof...(T)>{dtype<T>...} == dtypes;
 }
 
 template <template <class...> class Tuple, class... T, class... V>
@@ -56,9 +58,14 @@ decltype(auto) invoke(F &&f, V &&...v) {
       get_args(std::tuple_element_t<0, std::tuple<Tuple...>>{},
                std::forward<V>(v)...)));
 
+  // Resolve the element dtypes once instead of once per alternative. Each
+  // lookup goes through the variable factory, which dominates the cost of
+  // dispatching operations on small variables.
+  const std::array<DType, sizeof...(V)> dtypes{
+      variableFactory().elem_dtype(v)...};
   if constexpr (!std::is_same_v<void, Ret>) {
     Ret ret;
-    if (!((holds_alternatives(Tuple{}, v...)
+    if (!((holds_alternatives(Tuple{}, dtypes)
                ? (ret = std::apply(std::forward<F>(f),
                                    get_args(Tuple{}, std::forward<V>(v)...)),
                   true)
@@ -67,7 +74,7 @@ decltype(auto) invoke(F &&f, V &&...v) {
       throw std::bad_variant_access{};
     return ret;
   } else {
-    if (!((holds_alternatives(Tuple{}, v...)
+    if (!((holds_alternatives(Tuple{}, dtypes)
                ? (std::apply(std::forward<F>(f),
                              get_args(Tuple{}, std::forward<V>(v)...)),
                   true)
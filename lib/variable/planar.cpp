@@ -0,0 +1,239 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <algorithm>
+
+#include "scipp/core/eigen.h"
+#include "scipp/core/planar.h"
+#include "scipp/core/spatial_transforms.h"
+#include "scipp/variable/creation.h"
+#include "scipp/variable/except.h"
+#include "scipp/variable/planar.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/structures.h"
+
+namespace scipp::variable::planar {
+
+namespace {
+constexpr auto component = Dim::InternalStructureComponent;
+
+DType structure_dtype(const scipp::index n_planes) {
+  if (n_planes == 3)
+    return dtype<Eigen::Vector3d>;
+  if (n_planes == 9)
+    return dtype<Eigen::Matrix3d>;
+  throw except::TypeError("Planar layout is only supported for vector3 and "
+                          "linear_transform3.");
+}
+
+std::vector<std::string> keys(const DType type) {
+  return element_keys(empty(Dimensions{}, units::none, type));
+}
+
+void expect_planar(const Variable &planes) {
+  if (planes.dtype() != dtype<double> || !planes.dims().contains(component))
+    throw except::TypeError("Expected a variable in planar layout.");
+  if (planes.has_variances())
+    throw except::VariancesError("Planar vectors cannot have variances.");
+}
+
+/// Return planes with component dim outermost and contiguous memory layout.
+Variable as_contiguous_planes(const Variable &planes,
+                              const scipp::index n_planes) {
+  expect_planar(planes);
+  if (planes.dims()[component] != n_planes)
+    throw except::DimensionError("Expected " + std::to_string(n_planes) +
+                                 " planes, got " +
+                                 std::to_string(planes.dims()[component]) +
+                                 ".");
+  std::vector<Dim> order{component};
+  for (const auto &dim : planes.dims().labels())
+    if (dim != component)
+      order.push_back(dim);
+  auto out = transpose(planes, order);
+  if (Strides(out.strides()) != Strides(out.dims()))
+    out = copy(out);
+  return out;
+}
+
+Dimensions plane_dims(const Variable &planes) {
+  auto dims = planes.dims();
+  dims.erase(component);
+  return dims;
+}
+
+auto get_planes(const Variable &planes) {
+  const auto *base = planes.values<double>().as_span().data();
+  const auto size = planes.dims().volume() / planes.dims()[component];
+  return core::planar::Planes<const double>{base, base + size,
+                                            base + 2 * size};
+}
+
+auto get_planes(Variable &planes) {
+  auto *base = planes.values<double>().as_span().data();
+  const auto size = planes.dims().volume() / planes.dims()[component];
+  return core::planar::Planes<double>{base, base + size, base + 2 * size};
+}
+
+Variable make_planes(const Dimensions &dims, const units::Unit &unit,
+                     const scipp::index n_planes) {
+  auto planes_dims = dims;
+  planes_dims.add(component, n_planes);
+  return empty(planes_dims, unit, dtype<double>);
+}
+
+template <class T>
+void copy_to_planes(const Variable &var, const std::vector<std::string> &keys,
+                    Variable &planes) {
+  for (scipp::index i = 0; i < scipp::size(keys); ++i)
+    copy(var.elements<T>(keys[i]), planes.slice({component, i}));
+}
+
+template <class T>
+void copy_from_planes(const Variable &planes,
+                      const std::vector<std::string> &keys, Variable &var) {
+  for (scipp::index i = 0; i < scipp::size(keys); ++i)
+    copy(planes.slice({component, i}), var.elements<T>(keys[i]));
+}
+
+std::pair<Eigen::Matrix3d, Eigen::Vector3d>
+linear_and_translation(const Variable &transform) {
+  const auto type = transform.dtype();
+  if (type == dtype<Eigen::Matrix3d>)
+    return core::linear_and_translation(transform.value<Eigen::Matrix3d>());
+  if (type == dtype<Eigen::Affine3d>)
+    return core::linear_and_translation(transform.value<Eigen::Affine3d>());
+  if (type == dtype<core::Quaternion>)
+    return core::linear_and_translation(transform.value<core::Quaternion>());
+  if (type == dtype<core::Translation>)
+    return core::linear_and_translation(transform.value<core::Translation>());
+  throw except::TypeError("Cannot apply transform of dtype " +
+                          to_string(type) + " to planar vectors.");
+}
+
+units::Unit apply_unit(const Variable &transform, const Variable &vectors) {
+  const auto type = transform.dtype();
+  if (type == dtype<Eigen::Affine3d> || type == dtype<core::Translation>) {
+    if (transform.unit() != vectors.unit())
+      throw except::UnitError(
+          "Cannot apply spatial transform as the units of the transformation "
+          "are not the same as the units of transformation or vector.");
+    return vectors.unit();
+  }
+  return transform.unit() * vectors.unit();
+}
+} // namespace
+
+/// Return a copy of a variable of vectors or matrices in planar layout.
+///
+/// The output has dtype double and an additional outer dimension
+/// Dim::InternalStructureComponent with one entry for each element key.
+Variable to_planar(const Variable &var) {
+  const auto type = var.dtype();
+  if (type != dtype<Eigen::Vector3d> && type != dtype<Eigen::Matrix3d>)
+    throw except::TypeError("Planar layout is only supported for vector3 and "
+                            "linear_transform3, got " +
+                            to_string(type) + ".");
+  const auto field_keys = element_keys(var);
+  auto planes = make_planes(var.dims(), var.unit(), scipp::size(field_keys));
+  if (type == dtype<Eigen::Vector3d>)
+    copy_to_planes<Eigen::Vector3d>(var, field_keys, planes);
+  else
+    copy_to_planes<Eigen::Matrix3d>(var, field_keys, planes);
+  return planes;
+}
+
+/// Return a copy of planar vectors or matrices with dtype `type`.
+Variable from_planar(const Variable &planes, const DType type) {
+  expect_planar(planes);
+  if (structure_dtype(planes.dims()[component]) != type)
+    throw except::TypeError("Number of planes does not match dtype " +
+                            to_string(type) + ".");
+  auto var = empty(plane_dims(planes), planes.unit(), type);
+  const auto field_keys = keys(type);
+  if (type == dtype<Eigen::Vector3d>)
+    copy_from_planes<Eigen::Vector3d>(planes, field_keys, var);
+  else
+    copy_from_planes<Eigen::Matrix3d>(planes, field_keys, var);
+  return var;
+}
+
+/// Return a view of the plane holding the field `key`, e.g., "x" or "xy".
+///
+/// Unlike `Variable::elements`, this is a view of contiguous memory if
+/// `planes` is contiguous.
+Variable field(const Variable &planes, const std::string &key) {
+  expect_planar(planes);
+  const auto field_keys = keys(structure_dtype(planes.dims()[component]));
+  const auto it = std::find(field_keys.begin(), field_keys.end(), key);
+  if (it == field_keys.end())
+    throw except::NotFoundError("Invalid field name " + key + ".");
+  return planes.slice({component, std::distance(field_keys.begin(), it)});
+}
+
+Variable dot(const Variable &a, const Variable &b) {
+  const auto a_planes = as_contiguous_planes(a, 3);
+  const auto b_planes = as_contiguous_planes(b, 3);
+  core::expect::equals(a_planes.dims(), b_planes.dims());
+  auto out =
+      empty(plane_dims(a_planes), a.unit() * b.unit(), dtype<double>);
+  const auto pa = get_planes(a_planes);
+  const auto pb = get_planes(b_planes);
+  auto *po = out.values<double>().as_span().data();
+  core::planar::for_each_block(
+      out.dims().volume(), [&](const auto begin, const auto end) {
+        core::planar::dot(pa, pb, po, begin, end);
+      });
+  return out;
+}
+
+Variable cross(const Variable &a, const Variable &b) {
+  const auto a_planes = as_contiguous_planes(a, 3);
+  const auto b_planes = as_contiguous_planes(b, 3);
+  core::expect::equals(a_planes.dims(), b_planes.dims());
+  auto out = make_planes(plane_dims(a_planes), a.unit() * b.unit(), 3);
+  const auto pa = get_planes(a_planes);
+  const auto pb = get_planes(b_planes);
+  const auto po = get_planes(out);
+  core::planar::for_each_block(
+      plane_dims(out).volume(), [&](const auto begin, const auto end) {
+        core::planar::cross(pa, pb, po, begin, end);
+      });
+  return out;
+}
+
+Variable norm(const Variable &a) {
+  const auto a_planes = as_contiguous_planes(a, 3);
+  auto out = empty(plane_dims(a_planes), a.unit(), dtype<double>);
+  const auto pa = get_planes(a_planes);
+  auto *po = out.values<double>().as_span().data();
+  core::planar::for_each_block(
+      out.dims().volume(), [&](const auto begin, const auto end) {
+        core::planar::norm(pa, po, begin, end);
+      });
+  return out;
+}
+
+/// Apply a scalar spatial transform to planar vectors.
+///
+/// Supports linear_transform3, affine_transform3, rotation3, and
+/// translation3. The transform must be 0-D, its coefficients are hoisted out
+/// of the loop over vectors.
+Variable apply(const Variable &transform, const Variable &vectors) {
+  core::expect::ndim_is(transform.dims(), 0);
+  const auto coefficients = linear_and_translation(transform);
+  const auto unit = apply_unit(transform, vectors);
+  const auto in = as_contiguous_planes(vectors, 3);
+  auto out = make_planes(plane_dims(in), unit, 3);
+  const auto pin = get_planes(in);
+  const auto pout = get_planes(out);
+  core::planar::for_each_block(
+      plane_dims(out).volume(), [&](const auto begin, const auto end) {
+        core::planar::apply(coefficients.first, coefficients.second, pin,
+                            pout, begin, end);
+      });
+  return out;
+}
+
+} // namespace scipp::variable::planar
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <atomic>
+
+#include "scipp/variable/property_cache.h"
+#include "scipp/variable/variable.h"
+
+namespace scipp::variable {
+
+namespace {
+// Typically only few properties of few views of the same data are queried.
+constexpr scipp::index max_entries = 8;
+
+template <class Entry, class Generation>
+bool matches(const Entry &entry, const Variable &var,
+             const CachedProperty property, const Dim dim,
+             const Generation context) {
+  return entry.property == property && entry.dim == dim &&
+         entry.context == context && entry.offset == var.offset() &&
+         entry.dims == var.dims() && entry.strides == Strides(var.strides());
+}
+
+/// Return a generation that has not been used by any cache before.
+PropertyCache::Generation next_generation() noexcept {
+  static std::atomic<PropertyCache::Generation> counter{0};
+  return ++counter;
+}
+} // namespace
+
+PropertyCache::PropertyCache() noexcept : m_generation(next_generation()) {}
+
+PropertyCache::PropertyCache(const PropertyCache &) noexcept
+    : PropertyCache() {}
+
+PropertyCache &PropertyCache::operator=(const PropertyCache &) noexcept {
+  clear();
+  return *this;
+}
+
+/// Return the cached value of `property` of `var` along `dim`, if any.
+///
+/// `context` must match the value passed to `set`.
+std::optional<bool> PropertyCache::get(const Variable &var,
+                                       const CachedProperty property,
+                                       const Dim dim,
+                                       const Generation context) const {
+  std::lock_guard lock(m_mutex);
+  for (const auto &entry : m_entries)
+    if (matches(entry, var, property, dim, context))
+      return entry.value;
+  return std::nullopt;
+}
+
+/// Return the current generation, to be passed to `set`.
+///
+/// The generation must be obtained *before* computing a property, so values
+/// computed while the data is being modified are discarded. A disabled cache
+/// never returns the same generation twice, since its data may be modified
+/// at any time.
+PropertyCache::Generation PropertyCache::generation() const noexcept {
+  std::lock_guard lock(m_mutex);
+  return m_enabled ? m_generation : next_generation();
+}
+
+void PropertyCache::set(const Variable &var, const CachedProperty property,
+                        const Dim dim, const bool value,
+                        const Generation generation,
+                        const Generation context) {
+  std::lock_guard lock(m_mutex);
+  if (!m_enabled || generation != m_generation)
+    return;
+  if (scipp::size(m_entries) >= max_entries)
+    m_entries.erase(m_entries.begin());
+  m_entries.push_back(Entry{property, dim, var.offset(), var.dims(),
+                            Strides(var.strides()), context, value});
+}
+
+void PropertyCache::clear() noexcept {
+  std::lock_guard lock(m_mutex);
+  m_generation = next_generation();
+  m_entries.clear();
+}
+
+void PropertyCache::disable() noexcept {
+  std::lock_guard lock(m_mutex);
+  m_enabled = false;
+  m_generation = next_generation();
+  m_entries.clear();
+}
+
+} // namespace scipp::variable
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include "scipp/variable/quantile.h"
+#include "scipp/core/element/quantile.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/subspan_view.h"
+#include "scipp/variable/transform.h"
+
+namespace scipp::variable {
+
+namespace {
+void expect_valid_quantile(const double q) {
+  if (!(q >= 0.0 && q <= 1.0))
+    throw std::invalid_argument("Quantile must be in the range [0, 1], got " +
+                                std::to_string(q) + '.');
+}
+
+/// Return `var` or a copy of it such that `dim` has unit stride, as required
+/// for a subspan view.
+Variable contiguous_along(const Variable &var, const Dim dim) {
+  if (var.stride(dim) == 1)
+    return var;
+  std::vector<Dim> labels;
+  for (const auto &label : var.dims())
+    if (label != dim)
+      labels.push_back(label);
+  labels.push_back(dim);
+  return copy(transpose(var, labels));
+}
+
+/// Return `var` flattened to a single dimension, for reducing all dims.
+Variable flatten_all(const Variable &var) {
+  return flatten(var, var.dims().labels(), Dim::InternalAccumulate);
+}
+} // namespace
+
+/// Return the quantiles of the elements of each span in `values`.
+///
+/// Elements for which the corresponding element of `mask` is true are
+/// ignored, `mask` may be invalid. This is used for dense data as well as for
+/// bins, which provide spans into the event buffer. The selection is
+/// performed in parallel over the spans.
+Variable subspan_quantile(const Variable &values, const Variable &mask,
+                          const double q, const bool skip_nan) {
+  expect_valid_quantile(q);
+  using core::element::make_masked_quantile;
+  using core::element::make_quantile;
+  if (mask.is_valid())
+    return skip_nan ? variable::transform(values, mask,
+                                          make_masked_quantile<true>(q),
+                                          "nanquantile")
+                    : variable::transform(values, mask,
+                                          make_masked_quantile<false>(q),
+                                          "quantile");
+  return skip_nan
+             ? variable::transform(values, make_quantile<true>(q),
+                                   "nanquantile")
+             : variable::transform(values, make_quantile<false>(q), "quantile");
+}
+
+Variable quantile_impl(const Variable &var, const Dim dim, const double q,
+                       const bool skip_nan, const Variable &mask) {
+  const auto values = contiguous_along(var, dim);
+  if (!mask.is_valid())
+    return subspan_quantile(subspan_view(values, dim), {}, q, skip_nan);
+  const auto mask_ = contiguous_along(broadcast(mask, var.dims()), dim);
+  return subspan_quantile(subspan_view(values, dim), subspan_view(mask_, dim),
+                          q, skip_nan);
+}
+
+/// Return the `q`-quantile along given dimension.
+///
+/// Linear interpolation between the closest ranks is used, i.e., the same
+/// method as the default of `numpy.quantile`. The result is NaN if the input
+/// contains NaN values. Integer inputs yield a result of dtype float64.
+Variable quantile(const Variable &var, const Dim dim, const double q) {
+  return quantile_impl(var, dim, q, false);
+}
+
+/// Return the `q`-quantile along all dimensions.
+Variable quantile(const Variable &var, const double q) {
+  return quantile(flatten_all(var), Dim::InternalAccumulate, q);
+}
+
+/// Return the `q`-quantile along given dimension ignoring NaN values.
+Variable nanquantile(const Variable &var, const Dim dim, const double q) {
+  return quantile_impl(var, dim, q, true);
+}
+
+/// Return the `q`-quantile along all dimensions ignoring NaN values.
+Variable nanquantile(const Variable &var, const double q) {
+  return nanquantile(flatten_all(var), Dim::InternalAccumulate, q);
+}
+
+/// Return the median along given dimension.
+Variable median(const Variable &var, const Dim dim) {
+  return quantile(var, dim, 0.5);
+}
+
+/// Return the median along all dimensions.
+Variable median(const Variable &var) { return quantile(var, 0.5); }
+
+/// Return the median along given dimension ignoring NaN values.
+Variable nanmedian(const Variable &var, const Dim dim) {
+  return nanquantile(var, dim, 0.5);
+}
+
+/// Return the median along all dimensions ignoring NaN values.
+Variable nanmedian(const Variable &var) { return nanquantile(var, 0.5); }
+
+} // namespace scipp::variable
@@ -3,8 +3,10 @@
 /// @file
 /// @author Simon Heybrock
 #include <algorithm>
+#include <optional>
 
 #include "scipp/core/dimensions.h"
+#include "scipp/core/parallel.h"
 
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/bins.h"
@@ -59,18 +61,42 @@ Variable concat(const scipp::span<const Variable> vars, const Dim dim) {
     size += tmp.back().dims()[dim];
   }
   dims.resize(dim, size);
-  Variable out;
   if (is_bins(vars.front())) {
-    out = empty_like(vars.front(), {}, concat(get_bin_sizes(vars), dim));
-  } else {
-    out = empty_like(vars.front(), dims);
+    auto out = empty_like(vars.front(), {}, concat(get_bin_sizes(vars), dim));
+    scipp::index offset = 0;
+    for (const auto &var : tmp) {
+      const auto extent = var.dims()[dim];
+      out.data().copy(var, out.slice({dim, offset, offset + extent}));
+      offset += extent;
+    }
+    return out;
   }
+  // Validate all inputs before allocating the output, so we do not fail after
+  // having copied some of the inputs. The offsets of the inputs in the output
+  // are computed up front such that the copies can run in parallel.
+  std::vector<Slice> slices;
+  slices.reserve(tmp.size());
   scipp::index offset = 0;
   for (const auto &var : tmp) {
+    core::expect::equals(vars.front().dtype(), var.dtype());
+    core::expect::equals(vars.front().unit(), var.unit());
+    if (var.has_variances() != vars.front().has_variances())
+      throw except::VariancesError(
+          "Either all or none of the inputs must have variances.");
     const auto extent = var.dims()[dim];
-    out.data().copy(var, out.slice({dim, offset, offset + extent}));
+    auto slice_dims = dims;
+    slice_dims.resize(dim, extent);
+    expect::includes(slice_dims, var.dims());
+    slices.emplace_back(dim, offset, offset + extent);
     offset += extent;
   }
+  auto out = empty_like(vars.front(), dims);
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, scipp::size(tmp), 1),
+      [&](const auto &range) {
+        for (auto i = range.begin(); i != range.end(); ++i)
+          out.data().copy(tmp[i], out.slice(slices[i]));
+      });
   return out;
 }
 
@@ -99,6 +125,38 @@ Variable fold(const Variable &view, const Dim from_dim,
   return view.fold(from_dim, to_dims);
 }
 
+/// Return true if `flatten(var, from_labels, ...)` returns a view of `var`.
+///
+/// This is the case if the strides of the dimensions to flatten can be merged
+/// into a single stride. Dimensions of length 1 are ignored since their stride
+/// is irrelevant. Returns false if the labels are not a contiguous set of
+/// dimensions of `var` in the correct order.
+bool can_flatten_without_copy(const Variable &var,
+                              const scipp::span<const Dim> &from_labels) {
+  if (from_labels.empty())
+    return true;
+  const auto &dims = var.dims();
+  const auto &labels = dims.labels();
+  const auto it = std::search(labels.begin(), labels.end(),
+                              from_labels.begin(), from_labels.end());
+  if (it == labels.end())
+    return false;
+  const auto begin = std::distance(labels.begin(), it);
+  const auto end = begin + scipp::size(from_labels);
+  if (dims.volume() == 0)
+    return true;
+  // Stride that the next outer non-trivial dimension must have.
+  std::optional<scipp::index> expected_stride;
+  for (auto i = end - 1; i >= begin; --i) {
+    if (dims.size(i) == 1)
+      continue;
+    if (expected_stride && var.strides()[i] != *expected_stride)
+      return false;
+    expected_stride = dims.size(i) * var.strides()[i];
+  }
+  return true;
+}
+
 Variable flatten(const Variable &view,
                  const scipp::span<const Dim> &from_labels, const Dim to_dim) {
   if (from_labels.empty()) {
@@ -113,17 +171,25 @@ Variable flatten(const Variable &view,
   if (it == labels.end())
     throw except::DimensionError("Can only flatten a contiguous set of "
                                  "dimensions in the correct order");
+  if (!can_flatten_without_copy(view, from_labels))
+    return flatten(copy(view), from_labels, to_dim);
+  const auto to = std::distance(labels.begin(), it);
   scipp::index size = 1;
-  auto to = std::distance(labels.begin(), it);
+  // Stride of the innermost dimension that is not of length 1.
+  scipp::index stride = view.strides()[to + scipp::size(from_labels) - 1];
+  for (const auto &from : from_labels) {
+    const auto extent = view.dims()[from];
+    size *= extent;
+    if (extent != 1)
+      stride = view.strides()[view.dims().index(from)];
+  }
   auto out(view);
   for (const auto &from : from_labels) {
-    size *= out.dims().size(to);
     if (from == from_labels.back()) {
       out.unchecked_dims().resize(from, size);
       out.unchecked_dims().replace_key(from, to_dim);
+      out.unchecked_strides()[to] = stride;
     } else {
-      if (out.strides()[to] != out.dims().size(to + 1) * out.strides()[to + 1])
-        return flatten(copy(view), from_labels, to_dim);
       out.unchecked_dims().erase(from);
       out.unchecked_strides().erase(to);
     }
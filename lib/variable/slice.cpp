@@ -3,6 +3,7 @@
 /// @file
 /// @author Owen Arnold, Simon Heybrock
 #include <algorithm>
+#include <optional>
 
 #include "scipp/units/dim.h"
 #include "scipp/variable/comparison.h"
@@ -16,17 +17,105 @@ namespace scipp::variable {
 
 namespace {
 
+/// Return the index of the first element in `values` for which `pred` is
+/// false, assuming that it is true for all elements before and false for all
+/// elements after that.
+template <class T, class Pred>
+scipp::index partition_point(const ElementArrayView<const T> &values,
+                             Pred pred) {
+  scipp::index first = 0;
+  scipp::index count = values.size();
+  while (count > 0) {
+    const auto step = count / 2;
+    if (pred(values[first + step])) {
+      first += step + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+}
+
+/// Return `f(T{})` if `coord` and `value` have the same dtype T supporting
+/// binary search, or std::nullopt otherwise.
+template <class F>
+std::optional<scipp::index> visit_searchable(const Variable &coord,
+                                             const Variable &value, F f) {
+  if (coord.dtype() != value.dtype() || coord.has_variances() ||
+      value.has_variances())
+    return std::nullopt;
+  const auto type = coord.dtype();
+  if (type == dtype<double>)
+    return f(double{});
+  if (type == dtype<float>)
+    return f(float{});
+  if (type == dtype<int64_t>)
+    return f(int64_t{});
+  if (type == dtype<int32_t>)
+    return f(int32_t{});
+  if (type == dtype<core::time_point>)
+    return f(core::time_point{});
+  return std::nullopt;
+}
+
+/// Return the number of elements of `coord` that are less or equal (if
+/// `less_equal`) or greater or equal (otherwise) than `value`.
+///
+/// `coord` must be sorted in ascending order (if `ascending`) or descending
+/// order (otherwise).
 scipp::index get_count(const Variable &coord, const Dim dim,
-                       const Variable &value, const bool ascending) {
-  return (ascending ? sum(less_equal(coord, value), dim)
-                    : sum(greater_equal(coord, value), dim))
+                       const Variable &value, const bool less_equal,
+                       const bool ascending) {
+  // Binary search, with a fallback for mixed dtypes or variances.
+  if (const auto count =
+          visit_searchable(coord, value, [&](const auto tag) {
+            using T = std::decay_t<decltype(tag)>;
+            const auto &x = value.value<T>();
+            const auto values = coord.values<T>();
+            const auto size = values.size();
+            const auto le = [&](const T &v) { return v <= x; };
+            const auto lt = [&](const T &v) { return v < x; };
+            const auto ge = [&](const T &v) { return v >= x; };
+            const auto gt = [&](const T &v) { return v > x; };
+            if (less_equal)
+              return ascending ? partition_point(values, le)
+                               : size - partition_point(values, gt);
+            return ascending ? size - partition_point(values, lt)
+                             : partition_point(values, ge);
+          }))
+    return *count;
+  return (less_equal ? sum(variable::less_equal(coord, value), dim)
+                     : sum(greater_equal(coord, value), dim))
       .value<scipp::index>();
 }
 
+/// Return the index of the unique element equal to `value` in a sorted coord.
+///
+/// Returns -1 if there is no such element or it is not unique, and
+/// std::nullopt if binary search cannot be used.
+std::optional<scipp::index> find_sorted(const Variable &coord,
+                                        const Variable &value,
+                                        const bool ascending) {
+  return visit_searchable(coord, value, [&](const auto tag) {
+    using T = std::decay_t<decltype(tag)>;
+    const auto &x = value.value<T>();
+    const auto values = coord.values<T>();
+    const auto first =
+        ascending ? partition_point(values, [&](const T &v) { return v < x; })
+                  : partition_point(values, [&](const T &v) { return v > x; });
+    const auto last =
+        ascending
+            ? partition_point(values, [&](const T &v) { return v <= x; })
+            : partition_point(values, [&](const T &v) { return v >= x; });
+    return last - first == 1 ? first : scipp::index{-1};
+  });
+}
+
 scipp::index get_index(const Variable &coord, const Dim dim,
                        const Variable &value, const bool ascending,
                        const bool edges) {
-  auto i = get_count(coord, dim, value, edges == ascending);
+  auto i = get_count(coord, dim, value, edges == ascending, ascending);
   i = edges ? i - 1 : coord.dims()[dim] - i;
   return std::clamp<scipp::index>(0, i, coord.dims()[dim]);
 }
@@ -89,13 +178,31 @@ std::tuple<Dim, scipp::index> get_slice_params(const Sizes &dims,
   const auto dim = coord_.dims().inner();
   if (dims[dim] + 1 == coord_.dims()[dim]) {
     const auto &[coord, ascending] = get_coord(coord_, dim);
-    return std::tuple{dim, get_count(coord, dim, value, ascending) - 1};
+    return std::tuple{dim,
+                      get_count(coord, dim, value, ascending, ascending) - 1};
   } else {
-    auto eq = equal(get_1d_coord(coord_), value);
-    if (sum(eq, dim).template value<scipp::index>() != 1)
+    const auto &coord = get_1d_coord(coord_);
+    const auto throw_not_unique = [&]() {
       throw except::SliceError("Coord " + to_string(dim) +
                                " does not contain unique point with value " +
                                to_string(value) + '\n');
+    };
+    // Sortedness is cached with the coord, so this check is cheap when
+    // slicing the same coord repeatedly.
+    for (const auto order : {SortOrder::Ascending, SortOrder::Descending}) {
+      if (allsorted(coord, dim, order)) {
+        if (const auto index =
+                find_sorted(coord, value, order == SortOrder::Ascending)) {
+          if (*index < 0)
+            throw_not_unique();
+          return {dim, *index};
+        }
+        break;
+      }
+    }
+    auto eq = equal(coord, value);
+    if (sum(eq, dim).template value<scipp::index>() != 1)
+      throw_not_unique();
     auto values = eq.template values<bool>();
     auto it = std::find(values.begin(), values.end(), true);
     return {dim, std::distance(values.begin(), it)};
@@ -5,6 +5,8 @@
 #include "scipp/core/element/arg_list.h"
 
 #include "scipp/variable/accumulate.h"
+#include "scipp/variable/creation.h"
+#include "scipp/variable/cumulative.h"
 #include "scipp/variable/shape.h"
 #include "scipp/variable/variable.h"
 
@@ -170,3 +172,38 @@ TEST_F(AccumulateTest, 1d_to_scalar_non_idempotent_init) {
     EXPECT_EQ(result, 2 * units::one * expected) << i;
   }
 }
+
+namespace {
+/// Sum `var` along its inner dimension, element by element.
+auto sum_inner(const Variable &var) {
+  const auto dims = var.dims();
+  const auto inner = dims.inner();
+  auto out_dims = dims;
+  out_dims.erase(inner);
+  auto expected = makeVariable<int64_t>(out_dims);
+  const auto values = copy(var).values<int64_t>();
+  for (scipp::index i = 0; i < values.size(); ++i)
+    expected.values<int64_t>()[i / dims[inner]] += values[i];
+  return expected;
+}
+} // namespace
+
+TEST_F(AccumulateTest, 3d_inner_large_output_is_flattened) {
+  // Large enough for multi-threading, output has short outer dimension.
+  const auto var = cumsum(
+      variable::ones({{Dim::X, 2}, {Dim::Y, 3}, {Dim::Z, 4000}}, units::one,
+                     dtype<int64_t>));
+  auto result = makeVariable<int64_t>(Dims{Dim::X, Dim::Y}, Shape{2, 3});
+  accumulate_in_place<pair_self_t<int64_t>>(result, var, op, name);
+  EXPECT_EQ(result, sum_inner(var));
+}
+
+TEST_F(AccumulateTest, 3d_inner_non_flattenable_input) {
+  const auto var = cumsum(
+      variable::ones({{Dim::X, 2}, {Dim::Y, 4}, {Dim::Z, 4000}}, units::one,
+                     dtype<int64_t>));
+  const auto slice = var.slice({Dim::Y, 1, 4});
+  auto result = makeVariable<int64_t>(Dims{Dim::X, Dim::Y}, Shape{2, 3});
+  accumulate_in_place<pair_self_t<int64_t>>(result, slice, op, name);
+  EXPECT_EQ(result, sum_inner(slice));
+}
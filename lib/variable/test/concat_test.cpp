@@ -28,6 +28,15 @@ TEST_F(ConcatTest, type_mismatch) {
                        except::TypeError);
 }
 
+TEST_F(ConcatTest, variances_mismatch) {
+  auto other = copy(base);
+  other.setVariances(other);
+  EXPECT_THROW_DISCARD(concat(std::vector{base, other}, Dim::X),
+                       except::VariancesError);
+  EXPECT_THROW_DISCARD(concat(std::vector{other, base}, Dim::X),
+                       except::VariancesError);
+}
+
 TEST_F(ConcatTest, dimension_mismatch) {
   // Size mismatch
   EXPECT_THROW_DISCARD(
@@ -134,3 +143,25 @@ TEST_F(ConcatTest, multiple) {
     EXPECT_EQ(abc, a_bc);
   }
 }
+
+TEST_F(ConcatTest, many_inputs) {
+  std::vector<Variable> vars;
+  std::vector<double> expected;
+  for (scipp::index i = 0; i < 100; ++i) {
+    vars.emplace_back(makeVariable<double>(Dims{Dim::X}, Shape{i % 3 + 1},
+                                           units::m));
+    for (auto &x : vars.back().values<double>()) {
+      x = scipp::size(expected);
+      expected.push_back(x);
+    }
+  }
+  EXPECT_EQ(concat(vars, Dim::X),
+            makeVariable<double>(Dims{Dim::X}, Shape{expected.size()},
+                                 units::m, Values(expected)));
+}
+
+TEST_F(ConcatTest, many_inputs_mismatch_in_last) {
+  std::vector<Variable> vars(100, base);
+  vars.back() = base.slice({Dim::Y, 0, 1});
+  EXPECT_THROW_DISCARD(concat(vars, Dim::X), except::DimensionError);
+}
@@ -12,6 +12,7 @@
 #include "scipp/variable/except.h"
 #include "scipp/variable/misc_operations.h"
 #include "scipp/variable/operations.h"
+#include "scipp/variable/shape.h"
 #include "scipp/variable/variable.h"
 
 using namespace scipp;
@@ -928,6 +929,87 @@ TEST_F(ApplyTransformTest, apply_transform_to_vector_with_different_units) {
                        except::UnitError);
 }
 
+class ApplyScalarTransformTest : public ::testing::Test {
+protected:
+  ApplyScalarTransformTest() {
+    // Size is not a multiple of the block size used by the kernel.
+    std::vector<Eigen::Vector3d> values;
+    for (scipp::index i = 0; i < 19; ++i)
+      values.emplace_back(i, -2.0 * i, 0.5 * i + 1.0);
+    vectors = makeVariable<Eigen::Vector3d>(Dims{Dim::X}, Shape{19}, units::m,
+                                            Values(values.begin(),
+                                                   values.end()));
+    rotation = Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 3).normalized());
+  }
+
+  template <class T>
+  void check(const T &transform, const Variable &result,
+             const Variable &input) {
+    ASSERT_EQ(result.dims(), input.dims());
+    const auto out = result.values<Eigen::Vector3d>();
+    const auto in = input.values<Eigen::Vector3d>();
+    for (scipp::index i = 0; i < input.dims().volume(); ++i)
+      EXPECT_TRUE(out[i].isApprox(transform * in[i], 1e-12));
+  }
+
+  Variable vectors;
+  Eigen::Quaterniond rotation;
+};
+
+TEST_F(ApplyScalarTransformTest, linear) {
+  const Eigen::Matrix3d matrix = rotation.toRotationMatrix() * 2.0;
+  const auto transform =
+      makeVariable<Eigen::Matrix3d>(units::s, Values{matrix});
+  const auto result = transform * vectors;
+  EXPECT_EQ(result.unit(), units::m * units::s);
+  check(matrix, result, vectors);
+}
+
+TEST_F(ApplyScalarTransformTest, rotation) {
+  const auto transform = makeVariable<Quaternion>(Values{Quaternion(rotation)});
+  const auto result = transform * vectors;
+  EXPECT_EQ(result.unit(), units::m);
+  check(Quaternion(rotation), result, vectors);
+}
+
+TEST_F(ApplyScalarTransformTest, translation) {
+  const Translation translation(Eigen::Vector3d(1, -2, 3));
+  const auto transform =
+      makeVariable<Translation>(units::m, Values{translation});
+  check(translation, transform * vectors, vectors);
+  EXPECT_THROW_DISCARD(
+      makeVariable<Translation>(units::mm, Values{translation}) * vectors,
+      except::UnitError);
+}
+
+TEST_F(ApplyScalarTransformTest, affine) {
+  const Eigen::Affine3d affine(Eigen::Translation<double, 3>(1, -2, 3) *
+                               rotation);
+  const auto transform =
+      makeVariable<Eigen::Affine3d>(units::m, Values{affine});
+  check(affine, transform * vectors, vectors);
+}
+
+TEST_F(ApplyScalarTransformTest, composed_chain) {
+  const auto translation = makeVariable<Translation>(
+      units::m, Values{Translation(Eigen::Vector3d(1, -2, 3))});
+  const auto rot = makeVariable<Quaternion>(Values{Quaternion(rotation)});
+  const auto chain = rot * translation * rot;
+  const auto result = chain * vectors;
+  const auto expected = rot * (translation * (rot * vectors));
+  const auto out = result.values<Eigen::Vector3d>();
+  const auto ref = expected.values<Eigen::Vector3d>();
+  for (scipp::index i = 0; i < vectors.dims().volume(); ++i)
+    EXPECT_TRUE(out[i].isApprox(ref[i], 1e-12));
+}
+
+TEST_F(ApplyScalarTransformTest, non_contiguous_vectors) {
+  const auto transform = makeVariable<Quaternion>(Values{Quaternion(rotation)});
+  const auto input = concat(std::vector{vectors, vectors}, Dim::Y);
+  const auto transposed = transpose(input);
+  check(Quaternion(rotation), transform * transposed, transposed);
+}
+
 TEST(VariableTest, mul_vector) {
   Eigen::Vector3d vec1(1, 2, 3);
   Eigen::Vector3d vec2(2, 4, 6);
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "scipp/core/eigen.h"
+#include "scipp/core/spatial_transforms.h"
+#include "scipp/variable/math.h"
+#include "scipp/variable/planar.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/structures.h"
+
+#include "test_macros.h"
+
+using namespace scipp;
+using namespace scipp::variable;
+
+class PlanarTest : public ::testing::Test {
+protected:
+  Variable vectors = make_vectors(Dimensions(Dim::Y, 2), units::m,
+                                  {1, 2, 3, 4, 5, 6});
+  Variable other = make_vectors(Dimensions(Dim::Y, 2), units::s,
+                                {-1, 0, 2, 3, 1, -2});
+};
+
+TEST_F(PlanarTest, to_planar_layout) {
+  const auto planes = planar::to_planar(vectors);
+  EXPECT_EQ(planes,
+            makeVariable<double>(Dims{Dim::InternalStructureComponent, Dim::Y},
+                                 Shape{3, 2}, units::m,
+                                 Values{1, 4, 2, 5, 3, 6}));
+}
+
+TEST_F(PlanarTest, roundtrip) {
+  EXPECT_EQ(planar::from_planar(planar::to_planar(vectors),
+                                dtype<Eigen::Vector3d>),
+            vectors);
+  const auto matrices = make_matrices(
+      Dimensions(Dim::X, 2), units::m,
+      {1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 17, 18, 19});
+  EXPECT_EQ(planar::from_planar(planar::to_planar(matrices),
+                                dtype<Eigen::Matrix3d>),
+            matrices);
+}
+
+TEST_F(PlanarTest, to_planar_bad_dtype) {
+  EXPECT_THROW_DISCARD(planar::to_planar(makeVariable<double>(Values{1.0})),
+                       except::TypeError);
+}
+
+TEST_F(PlanarTest, field_is_contiguous_view) {
+  const auto planes = planar::to_planar(vectors);
+  for (const auto &key : {"x", "y", "z"}) {
+    const auto plane = planar::field(planes, key);
+    EXPECT_EQ(plane, copy(vectors.elements<Eigen::Vector3d>(key)));
+    EXPECT_EQ(plane.stride(Dim::Y), 1);
+    EXPECT_TRUE(plane.data_handle() == planes.data_handle());
+  }
+  EXPECT_THROW_DISCARD(planar::field(planes, "xx"), except::NotFoundError);
+}
+
+TEST_F(PlanarTest, dot) {
+  EXPECT_EQ(planar::dot(planar::to_planar(vectors), planar::to_planar(other)),
+            variable::dot(vectors, other));
+}
+
+TEST_F(PlanarTest, cross) {
+  EXPECT_EQ(planar::cross(planar::to_planar(vectors), planar::to_planar(other)),
+            planar::to_planar(variable::cross(vectors, other)));
+}
+
+TEST_F(PlanarTest, norm) {
+  EXPECT_EQ(planar::norm(planar::to_planar(vectors)), variable::norm(vectors));
+}
+
+TEST_F(PlanarTest, non_contiguous_input) {
+  const auto planes = transpose(planar::to_planar(vectors));
+  EXPECT_EQ(planar::norm(planes), variable::norm(vectors));
+}
+
+TEST_F(PlanarTest, apply_matrix) {
+  Eigen::Matrix3d rot;
+  rot << 0, -1, 0, 1, 0, 0, 0, 0, 1;
+  const auto matrix = makeVariable<Eigen::Matrix3d>(Values{rot});
+  EXPECT_EQ(planar::apply(matrix, planar::to_planar(vectors)),
+            planar::to_planar(matrix * vectors));
+}
+
+TEST_F(PlanarTest, apply_affine) {
+  Eigen::Affine3d affine(Eigen::Translation<double, 3>(1, 2, 3));
+  affine.linear() << 0, -1, 0, 1, 0, 0, 0, 0, 1;
+  const auto transform =
+      makeVariable<Eigen::Affine3d>(units::m, Values{affine});
+  const auto expected = make_vectors(Dimensions(Dim::Y, 2), units::m,
+                                     {-1, 3, 6, -4, 6, 9});
+  EXPECT_EQ(planar::apply(transform, planar::to_planar(vectors)),
+            planar::to_planar(expected));
+  EXPECT_THROW_DISCARD(
+      planar::apply(makeVariable<Eigen::Affine3d>(units::s, Values{affine}),
+                    planar::to_planar(vectors)),
+      except::UnitError);
+}
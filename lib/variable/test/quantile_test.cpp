@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+
+#include "scipp/core/except.h"
+#include "scipp/variable/quantile.h"
+#include "scipp/variable/shape.h"
+
+#include "test_macros.h"
+
+using namespace scipp;
+
+namespace {
+const auto NaN = std::numeric_limits<double>::quiet_NaN();
+}
+
+TEST(QuantileTest, median_odd_and_even_length) {
+  const auto odd = makeVariable<double>(Dims{Dim::X}, Shape{5}, units::m,
+                                        Values{3.0, -1.0, 7.0, 2.0, 5.0});
+  EXPECT_EQ(median(odd, Dim::X), makeVariable<double>(units::m, Values{3.0}));
+  const auto even = makeVariable<double>(Dims{Dim::X}, Shape{4}, units::m,
+                                         Values{4.0, 1.0, 3.0, 2.0});
+  EXPECT_EQ(median(even, Dim::X), makeVariable<double>(units::m, Values{2.5}));
+}
+
+TEST(QuantileTest, quantile_interpolates_linearly) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{5},
+                                        Values{10.0, 0.0, 40.0, 20.0, 30.0});
+  EXPECT_EQ(quantile(var, Dim::X, 0.0), makeVariable<double>(Values{0.0}));
+  EXPECT_EQ(quantile(var, Dim::X, 1.0), makeVariable<double>(Values{40.0}));
+  EXPECT_EQ(quantile(var, Dim::X, 0.25), makeVariable<double>(Values{10.0}));
+  EXPECT_EQ(quantile(var, Dim::X, 0.375), makeVariable<double>(Values{15.0}));
+}
+
+TEST(QuantileTest, matches_sort_for_many_values) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> dist(-1e3, 1e3);
+  std::vector<double> values(10001);
+  std::generate(values.begin(), values.end(), [&]() { return dist(rng); });
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{values.size()},
+                                        Values(values.begin(), values.end()));
+  std::sort(values.begin(), values.end());
+  EXPECT_EQ(median(var, Dim::X).value<double>(), values[5000]);
+  EXPECT_EQ(quantile(var, Dim::X, 0.9).value<double>(), values[9000]);
+}
+
+TEST(QuantileTest, outer_dim) {
+  const auto var =
+      makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{3, 2}, units::s,
+                           Values{1.0, 6.0, 3.0, 4.0, 2.0, 5.0});
+  EXPECT_EQ(median(var, Dim::Y),
+            makeVariable<double>(Dims{Dim::X}, Shape{2}, units::s,
+                                 Values{2.0, 5.0}));
+  EXPECT_EQ(median(var, Dim::X),
+            makeVariable<double>(Dims{Dim::Y}, Shape{3}, units::s,
+                                 Values{3.5, 3.5, 3.5}));
+  EXPECT_EQ(median(transpose(var), Dim::Y), median(var, Dim::Y));
+  EXPECT_EQ(median(var.slice({Dim::Y, 1, 3}), Dim::Y),
+            makeVariable<double>(Dims{Dim::X}, Shape{2}, units::s,
+                                 Values{2.5, 4.5}));
+}
+
+TEST(QuantileTest, all_dims) {
+  const auto var =
+      makeVariable<int64_t>(Dims{Dim::Y, Dim::X}, Shape{2, 3}, units::m,
+                            Values{1, 6, 3, 4, 2, 5});
+  EXPECT_EQ(median(var), makeVariable<double>(units::m, Values{3.5}));
+  EXPECT_EQ(median(transpose(var)),
+            makeVariable<double>(units::m, Values{3.5}));
+  EXPECT_EQ(quantile(var, 0.2), makeVariable<double>(units::m, Values{2.0}));
+  EXPECT_EQ(median(makeVariable<float>(Values{2.0f})),
+            makeVariable<float>(Values{2.0f}));
+}
+
+TEST(QuantileTest, dtype) {
+  const auto i32 = makeVariable<int32_t>(Dims{Dim::X}, Shape{2}, Values{1, 2});
+  EXPECT_EQ(median(i32, Dim::X), makeVariable<double>(Values{1.5}));
+  const auto f32 =
+      makeVariable<float>(Dims{Dim::X}, Shape{2}, Values{1.0f, 2.0f});
+  EXPECT_EQ(median(f32, Dim::X), makeVariable<float>(Values{1.5f}));
+  EXPECT_THROW_DISCARD(
+      median(makeVariable<std::string>(Dims{Dim::X}, Shape{2}), Dim::X),
+      except::TypeError);
+}
+
+TEST(QuantileTest, nan_handling) {
+  const auto var = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                        Values{1.0, NaN, 2.0, NaN, NaN, NaN});
+  const auto m = median(var, Dim::X);
+  EXPECT_TRUE(std::isnan(m.values<double>()[0]));
+  EXPECT_TRUE(std::isnan(m.values<double>()[1]));
+  const auto nm = nanmedian(var, Dim::X);
+  EXPECT_EQ(nm.values<double>()[0], 1.5);
+  EXPECT_TRUE(std::isnan(nm.values<double>()[1]));
+  EXPECT_EQ(nanquantile(var, 1.0), makeVariable<double>(Values{2.0}));
+}
+
+TEST(QuantileTest, empty) {
+  const auto var = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 0});
+  const auto m = median(var, Dim::X);
+  EXPECT_EQ(m.dims(), (Dimensions{Dim::Y, 2}));
+  EXPECT_TRUE(std::isnan(m.values<double>()[0]));
+  EXPECT_EQ(median(var, Dim::Y).dims(), (Dimensions{Dim::X, 0}));
+}
+
+TEST(QuantileTest, masked) {
+  const auto var = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                        Values{1.0, 9.0, 2.0, 3.0, 4.0, 9.0});
+  const auto mask =
+      makeVariable<bool>(Dims{Dim::X}, Shape{3}, Values{false, true, false});
+  EXPECT_EQ(quantile_impl(var, Dim::X, 0.5, false, mask),
+            makeVariable<double>(Dims{Dim::Y}, Shape{2}, Values{1.5, 6.0}));
+  EXPECT_TRUE(equals_nan(quantile_impl(var, Dim::Y, 0.5, false, mask),
+                         makeVariable<double>(Dims{Dim::X}, Shape{3},
+                                              Values{2.0, NaN, 5.5})));
+}
+
+TEST(QuantileTest, fail_variances) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{1, 2},
+                                        Variances{1, 2});
+  EXPECT_THROW_DISCARD(median(var, Dim::X), except::VariancesError);
+}
+
+TEST(QuantileTest, fail_bad_quantile_or_dim) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{1, 2});
+  EXPECT_THROW_DISCARD(quantile(var, Dim::X, -0.1), std::invalid_argument);
+  EXPECT_THROW_DISCARD(quantile(var, Dim::X, 1.5), std::invalid_argument);
+  EXPECT_THROW_DISCARD(quantile(var, Dim::X, NaN), std::invalid_argument);
+  EXPECT_THROW_DISCARD(median(var, Dim::Y), except::DimensionError);
+}
@@ -206,6 +206,73 @@ TEST(ShapeTest, flatten_slice) {
   EXPECT_NE(flat.data_handle(), var.data_handle()); // copy since noncontiguous
 }
 
+TEST(ShapeTest, flatten_slice_of_outer_dim) {
+  const auto var = cumsum(
+      variable::ones({{Dim::X, 4}, {Dim::Y, 5}}, units::m, dtype<double>));
+  const auto flat = flatten(var.slice({Dim::X, 1, 3}),
+                            std::vector<Dim>{Dim::X, Dim::Y}, Dim::Z);
+  EXPECT_EQ(flat, cumsum(variable::ones({{Dim::Z, 10}}, units::m,
+                                        dtype<double>)) +
+                      5.0 * units::m);
+  EXPECT_EQ(flat.data_handle(), var.data_handle()); // shared
+}
+
+TEST(ShapeTest, flatten_length_1_dim_with_arbitrary_stride) {
+  const auto var = cumsum(
+      variable::ones({{Dim::X, 4}, {Dim::Y, 5}}, units::m, dtype<double>));
+  const auto flat = flatten(var.slice({Dim::Y, 2, 3}),
+                            std::vector<Dim>{Dim::X, Dim::Y}, Dim::Z);
+  EXPECT_EQ(flat, makeVariable<double>(Dims{Dim::Z}, Shape{4}, units::m,
+                                       Values{3, 8, 13, 18}));
+  EXPECT_EQ(flat.data_handle(), var.data_handle()); // shared
+  EXPECT_EQ(flat.strides()[0], 5);
+}
+
+TEST(ShapeTest, flatten_broadcast) {
+  const auto var = makeVariable<double>(Values{1.0});
+  const auto flat =
+      flatten(broadcast(var, {{Dim::X, Dim::Y}, {2, 3}}),
+              std::vector<Dim>{Dim::X, Dim::Y}, Dim::Z);
+  EXPECT_EQ(flat, broadcast(var, {{Dim::Z}, {6}}));
+  EXPECT_EQ(flat.data_handle(), var.data_handle()); // shared
+  EXPECT_TRUE(flat.is_readonly());
+}
+
+TEST(ShapeTest, can_flatten_without_copy) {
+  const auto var = makeVariable<double>(Dims{Dim::X, Dim::Y, Dim::Z},
+                                        Shape{2, 3, 4});
+  const std::vector<Dim> xy{Dim::X, Dim::Y};
+  const std::vector<Dim> yz{Dim::Y, Dim::Z};
+  const std::vector<Dim> xyz{Dim::X, Dim::Y, Dim::Z};
+  EXPECT_TRUE(can_flatten_without_copy(var, std::vector<Dim>{}));
+  EXPECT_TRUE(can_flatten_without_copy(var, std::vector<Dim>{Dim::Y}));
+  EXPECT_TRUE(can_flatten_without_copy(var, xy));
+  EXPECT_TRUE(can_flatten_without_copy(var, yz));
+  EXPECT_TRUE(can_flatten_without_copy(var, xyz));
+  // Not a contiguous set of dimensions in the correct order
+  EXPECT_FALSE(can_flatten_without_copy(var, std::vector<Dim>{Dim::X, Dim::Z}));
+  EXPECT_FALSE(can_flatten_without_copy(var, std::vector<Dim>{Dim::Y, Dim::X}));
+  EXPECT_FALSE(can_flatten_without_copy(transpose(var), yz));
+  // Slices
+  EXPECT_TRUE(can_flatten_without_copy(var.slice({Dim::X, 1, 2}), xyz));
+  EXPECT_TRUE(can_flatten_without_copy(var.slice({Dim::Z, 1, 3}), xy));
+  EXPECT_FALSE(can_flatten_without_copy(var.slice({Dim::Z, 1, 3}), yz));
+  EXPECT_FALSE(can_flatten_without_copy(var.slice({Dim::Y, 1, 3}), xy));
+  EXPECT_TRUE(can_flatten_without_copy(var.slice({Dim::Y, 1, 2}), xy));
+  EXPECT_FALSE(can_flatten_without_copy(var.slice({Dim::Y, 1, 2}), xyz));
+  EXPECT_TRUE(can_flatten_without_copy(var.slice({Dim::Y, 1, 1}), xy));
+  // Broadcasts
+  EXPECT_TRUE(can_flatten_without_copy(
+      broadcast(var, {{Dim::Time, Dim::X, Dim::Y, Dim::Z}, {5, 2, 3, 4}}),
+      std::vector<Dim>{Dim::Time}));
+  EXPECT_FALSE(can_flatten_without_copy(
+      broadcast(var, {{Dim::Time, Dim::X, Dim::Y, Dim::Z}, {5, 2, 3, 4}}),
+      std::vector<Dim>{Dim::Time, Dim::X}));
+  EXPECT_FALSE(can_flatten_without_copy(
+      broadcast(var, {{Dim::X, Dim::Y, Dim::Z, Dim::Time}, {2, 3, 4, 5}}),
+      std::vector<Dim>{Dim::Z, Dim::Time}));
+}
+
 TEST(ShapeTest, flatten_bad_dim_order) {
   const auto var = cumsum(
       variable::ones({{Dim::X, 6}, {Dim::Y, 4}}, units::m, dtype<double>));
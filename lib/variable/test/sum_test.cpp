@@ -38,6 +38,29 @@ TEST_F(SumTest, sum_with_empty_dim) {
             makeVariable<double>(Dims{Dim::X}, Shape{0}, units::m, Values{}));
 }
 
+TEST(SumVariancesTest, sum_inner) {
+  // Size is not a multiple of the number of partial sums in the kernel.
+  const scipp::index size = 1001;
+  auto var = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, size},
+                                  units::m, Values{}, Variances{});
+  double expected_values[2] = {0.0, 0.0};
+  double expected_variances[2] = {0.0, 0.0};
+  for (scipp::index i = 0; i < 2 * size; ++i) {
+    var.values<double>()[i] = 0.5 * static_cast<double>(i);
+    var.variances<double>()[i] = 0.25 * static_cast<double>(i);
+    expected_values[i / size] += 0.5 * static_cast<double>(i);
+    expected_variances[i / size] += 0.25 * static_cast<double>(i);
+  }
+  const auto summed = sum(var, Dim::X);
+  for (scipp::index i = 0; i < 2; ++i) {
+    EXPECT_DOUBLE_EQ(summed.values<double>()[i], expected_values[i]);
+    EXPECT_DOUBLE_EQ(summed.variances<double>()[i], expected_variances[i]);
+  }
+  const auto total = sum(var.slice({Dim::Y, 0}));
+  EXPECT_DOUBLE_EQ(total.value<double>(), expected_values[0]);
+  EXPECT_DOUBLE_EQ(total.variance<double>(), expected_variances[0]);
+}
+
 TEST(VectorReduceTest, sum_vector) {
   const auto vector_var = makeVariable<Eigen::Vector3d>(
       Dims{Dim::X}, Shape{2}, units::m,
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "scipp/common/constants.h"
+#include "scipp/core/vectorized_math.h"
 #include "scipp/variable/creation.h"
 #include "scipp/variable/to_unit.h"
 #include "scipp/variable/trigonometry.h"
@@ -42,13 +43,13 @@ protected:
 
 TEST_F(VariableTrigonometryTest, sin_rad) {
   const auto var = copy(input_in_rad());
-  EXPECT_EQ(sin(var), expected_for_op(std::sin));
+  EXPECT_EQ(sin(var), expected_for_op(core::vectorized_math::sin));
   EXPECT_EQ(var, input_in_rad());
 }
 
 TEST_F(VariableTrigonometryTest, sin_deg) {
   const auto var = copy(input_in_deg());
-  EXPECT_EQ(sin(var), expected_for_op(std::sin));
+  EXPECT_EQ(sin(var), expected_for_op(core::vectorized_math::sin));
   EXPECT_EQ(var, input_in_deg());
 }
 
@@ -57,7 +58,7 @@ TEST_F(VariableTrigonometryTest, sin_out_arg_rad) {
   auto out = special_like(in, FillValue::ZeroNotBool);
   auto &view = sin(in, out);
 
-  EXPECT_EQ(out, expected_for_op(std::sin));
+  EXPECT_EQ(out, expected_for_op(core::vectorized_math::sin));
   EXPECT_EQ(&view, &out);
   EXPECT_EQ(in, input_in_rad());
 }
@@ -67,20 +68,20 @@ TEST_F(VariableTrigonometryTest, sin_out_arg_deg) {
   auto out = special_like(in, FillValue::ZeroNotBool);
   auto &view = sin(in, out);
 
-  EXPECT_EQ(out, expected_for_op(std::sin));
+  EXPECT_EQ(out, expected_for_op(core::vectorized_math::sin));
   EXPECT_EQ(&view, &out);
   EXPECT_EQ(in, input_in_deg());
 }
 
 TEST_F(VariableTrigonometryTest, cos_rad) {
   const auto var = copy(input_in_rad());
-  EXPECT_EQ(cos(var), expected_for_op(std::cos));
+  EXPECT_EQ(cos(var), expected_for_op(core::vectorized_math::cos));
   EXPECT_EQ(var, input_in_rad());
 }
 
 TEST_F(VariableTrigonometryTest, cos_deg) {
   const auto var = copy(input_in_deg());
-  EXPECT_EQ(cos(var), expected_for_op(std::cos));
+  EXPECT_EQ(cos(var), expected_for_op(core::vectorized_math::cos));
   EXPECT_EQ(var, input_in_deg());
 }
 
@@ -89,7 +90,7 @@ TEST_F(VariableTrigonometryTest, cos_out_arg_rad) {
   auto out = special_like(in, FillValue::ZeroNotBool);
   auto &view = cos(in, out);
 
-  EXPECT_EQ(out, expected_for_op(std::cos));
+  EXPECT_EQ(out, expected_for_op(core::vectorized_math::cos));
   EXPECT_EQ(&view, &out);
   EXPECT_EQ(in, input_in_rad());
 }
@@ -99,7 +100,7 @@ TEST_F(VariableTrigonometryTest, cos_out_arg_deg) {
   auto out = special_like(in, FillValue::ZeroNotBool);
   auto &view = cos(in, out);
 
-  EXPECT_EQ(out, expected_for_op(std::cos));
+  EXPECT_EQ(out, expected_for_op(core::vectorized_math::cos));
   EXPECT_EQ(&view, &out);
   EXPECT_EQ(in, input_in_deg());
 }
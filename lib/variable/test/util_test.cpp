@@ -150,6 +150,56 @@ TEST(UtilTest, allsorted_multidimensional) {
   EXPECT_TRUE(allsorted(var, Dim::X, SortOrder::Descending));
 }
 
+TEST(UtilTest, allsorted_is_recomputed_after_write) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Values{1, 2, 3}, Shape{3});
+  EXPECT_TRUE(allsorted(var, Dim::X));
+  EXPECT_TRUE(allsorted(var, Dim::X));
+  var.values<double>()[0] = 4.0;
+  EXPECT_FALSE(allsorted(var, Dim::X));
+  var.values<double>()[0] = 0.0;
+  EXPECT_TRUE(allsorted(var, Dim::X));
+}
+
+TEST(UtilTest, allsorted_is_recomputed_after_write_to_view) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Values{1, 2, 3}, Shape{3});
+  EXPECT_TRUE(allsorted(var, Dim::X));
+  auto view = var.slice({Dim::X, 1, 3});
+  EXPECT_TRUE(allsorted(view, Dim::X));
+  view.values<double>()[1] = 0.0;
+  EXPECT_FALSE(allsorted(var, Dim::X));
+  EXPECT_FALSE(allsorted(view, Dim::X));
+  copy(makeVariable<double>(Dims{Dim::X}, Values{5, 6}, Shape{2}), view);
+  EXPECT_TRUE(allsorted(var, Dim::X));
+}
+
+TEST(UtilTest, allsorted_distinguishes_slices) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Values{3, 1, 2}, Shape{3});
+  EXPECT_FALSE(allsorted(var, Dim::X));
+  EXPECT_TRUE(allsorted(var.slice({Dim::X, 1, 3}), Dim::X));
+  EXPECT_FALSE(allsorted(var.slice({Dim::X, 0, 2}), Dim::X));
+  EXPECT_TRUE(allsorted(var.slice({Dim::X, 0, 2}), Dim::X,
+                        SortOrder::Descending));
+}
+
+TEST(UtilTest, allsorted_copy_is_independent) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Values{1, 2, 3}, Shape{3});
+  EXPECT_TRUE(allsorted(var, Dim::X));
+  auto other = copy(var);
+  other.values<double>()[0] = 4.0;
+  EXPECT_TRUE(allsorted(var, Dim::X));
+  EXPECT_FALSE(allsorted(other, Dim::X));
+}
+
+TEST(UtilTest, alllinspace) {
+  auto var = makeVariable<double>(Dimensions{{Dim::X, 2}, {Dim::Y, 3}},
+                                  Values{1, 2, 3, 2, 4, 6});
+  EXPECT_TRUE(alllinspace(var, Dim::Y));
+  EXPECT_TRUE(alllinspace(var, Dim::Y));
+  var.values<double>()[5] = 7.0;
+  EXPECT_FALSE(alllinspace(var, Dim::Y));
+  EXPECT_TRUE(alllinspace(var.slice({Dim::X, 0}), Dim::Y));
+}
+
 TEST(VariableTest, where) {
   auto var =
       makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m, Values{1, 2, 3});
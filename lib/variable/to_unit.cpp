@@ -27,18 +27,38 @@ bool greater_than_days(const units::Unit &unit) {
 }
 } // namespace
 
+/// Return the factor by which `to_unit` scales values in unit `from` to
+/// obtain values in unit `to`.
+///
+/// Consumers such as histogramming can apply this factor on the fly instead
+/// of materializing a converted copy of their input. The factor is identical
+/// to the one used by `to_unit`, so results agree exactly for floating-point
+/// values.
+double to_unit_scale(const units::Unit &from, const units::Unit &to) {
+  if (from == to)
+    return 1.0;
+  if ((from == units::none) || (to == units::none))
+    throw except::UnitError("Unit conversion to / from None is not permitted.");
+  const auto scale =
+      llnl::units::quick_convert(from.underlying(), to.underlying());
+  if (std::isnan(scale))
+    throw except::UnitError("Conversion from `" + to_string(from) + "` to `" +
+                            to_string(to) + "` is not valid.");
+  // Need to make sure that errors due to machine precision actually affect
+  // decimal places, otherwise the approach based on std::round will do nothing.
+  const auto base_scale = scale > 1e6 ? scale * 1e-6 : scale;
+  if (const auto iscale = std::round(base_scale);
+      (std::abs(base_scale - iscale) < 1e-12 * std::abs(base_scale)))
+    return (scale > 1e6 ? 1000000 : 1) * iscale;
+  return scale;
+}
+
 Variable to_unit(const Variable &var, const units::Unit &unit,
                  const CopyPolicy copy) {
   const auto var_unit = variableFactory().elem_unit(var);
   if (unit == var_unit)
     return copy == CopyPolicy::Always ? variable::copy(var) : var;
-  if ((var_unit == units::none) || (unit == units::none))
-    throw except::UnitError("Unit conversion to / from None is not permitted.");
-  const auto scale =
-      llnl::units::quick_convert(var_unit.underlying(), unit.underlying());
-  if (std::isnan(scale))
-    throw except::UnitError("Conversion from `" + to_string(var_unit) +
-                            "` to `" + to_string(unit) + "` is not valid.");
+  const auto scale = to_unit_scale(var_unit, unit);
   if (var.dtype() == dtype<core::time_point> &&
       (greater_than_days(variableFactory().elem_unit(var)) ||
        greater_than_days(unit))) {
@@ -50,16 +70,11 @@ Variable to_unit(const Variable &var, const units::Unit &unit,
         "information about calendars and time zones.");
   }
   Variable scalevar;
-  // Need to make sure that errors due to machine precision actually affect
-  // decimal places, otherwise the approach based on std::round will do nothing.
-  const auto base_scale = scale > 1e6 ? scale * 1e-6 : scale;
-  if (const auto iscale = std::round(base_scale);
-      (std::abs(base_scale - iscale) < 1e-12 * std::abs(base_scale))) {
+  if (const auto iscale = std::round(scale); iscale == scale) {
     if (var.dtype() == dtype<int64_t> || var.dtype() == dtype<core::time_point>)
-      scalevar = int64_t{scale > 1e6 ? 1000000 : 1} *
-                 static_cast<int64_t>(iscale) * unit;
+      scalevar = static_cast<int64_t>(iscale) * unit;
     else
-      scalevar = (scale > 1e6 ? 1000000 : 1) * iscale * unit;
+      scalevar = iscale * unit;
   } else {
     scalevar = scale * unit;
   }
@@ -11,6 +11,8 @@
 #include "scipp/variable/reduction.h"
 #include "scipp/variable/subspan_view.h"
 #include "scipp/variable/transform.h"
+#include "scipp/variable/variable_concept.h"
+#include "scipp/variable/variable_factory.h"
 
 using namespace scipp::core;
 
@@ -43,11 +45,41 @@ Variable linspace(const Variable &start, const Variable &stop, const Dim dim,
   return out;
 }
 
+namespace {
+/// Return `compute()`, reusing the value cached with the data of `var`.
+///
+/// Binned variables are not cached since their buffer can be modified without
+/// non-const access to the variable.
+template <class Compute>
+bool cached(const Variable &var, const CachedProperty property, const Dim dim,
+            Compute compute) {
+  if (is_bins(var))
+    return compute();
+  auto &cache = var.data().property_cache();
+  if (const auto value = cache.get(var, property, dim))
+    return *value;
+  const auto generation = cache.generation();
+  const bool value = compute();
+  cache.set(var, property, dim, value, generation);
+  return value;
+}
+} // namespace
+
 Variable islinspace(const Variable &var, const Dim dim) {
   return transform(subspan_view(var, dim), core::element::islinspace,
                    "islinspace");
 }
 
+/// Return true if variable values are evenly spaced along given dim.
+///
+/// The result is cached with the data of `var` and reused in subsequent calls
+/// until the data is modified.
+bool alllinspace(const Variable &var, const Dim dim) {
+  return cached(var, CachedProperty::Linspace, dim, [&]() {
+    return variable::all(islinspace(var, dim)).value<bool>();
+  });
+}
+
 /// Return a variable of True, if variable values are sorted along given dim.
 ///
 /// If `order` is SortOrder::Ascending, checks if values are non-decreasing.
@@ -74,8 +106,16 @@ Variable issorted(const Variable &x, const Dim dim, const SortOrder order) {
 ///
 /// If `order` is SortOrder::Ascending, checks if values are non-decreasing.
 /// If `order` is SortOrder::Descending, checks if values are non-increasing.
+/// The result is cached with the data of `x` and reused in subsequent calls
+/// until the data is modified.
 bool allsorted(const Variable &x, const Dim dim, const SortOrder order) {
-  return variable::all(issorted(x, dim, order)).value<bool>();
+  return cached(x,
+                order == SortOrder::Ascending
+                    ? CachedProperty::SortedAscending
+                    : CachedProperty::SortedDescending,
+                dim, [&]() {
+                  return variable::all(issorted(x, dim, order)).value<bool>();
+                });
 }
 
 /// Zip elements of two variables into a variable where each element is a pair.
@@ -162,6 +162,8 @@ const VariableConcept &Variable::data() const & { return *m_object; }
 
 VariableConcept &Variable::data() & {
   expect_writable();
+  // The caller may modify the data, so cached properties become invalid.
+  m_object->property_cache().clear();
   return *m_object;
 }
 
@@ -48,14 +48,49 @@ from . import geometry
 # Import functions
 from ._scipp.core import as_const
 
-# Import python functions
-from .show import show, make_svg
+# Modules for visualization and example data are not needed for computations.
+# They are only imported on first access to reduce the time of `import scipp`.
+_LAZY_ATTRIBUTES = {
+    'show': 'show',
+    'make_svg': 'show',
+    'to_html': 'html',
+    'make_html': 'html',
+    'table': 'html',
+    'plot': 'plotting',
+    'data': None,
+}
 
-from .html import to_html, make_html, table
 
-setattr(Variable, '_repr_html_', make_html)
-setattr(DataArray, '_repr_html_', make_html)
-setattr(Dataset, '_repr_html_', make_html)
+def __getattr__(name: str):
+    import importlib
+
+    if name not in _LAZY_ATTRIBUTES:
+        raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+    module = _LAZY_ATTRIBUTES[name]
+    if module is None:
+        value = importlib.import_module(f'.{name}', __name__)
+    else:
+        value = getattr(importlib.import_module(f'.{module}', __name__), name)
+    # Importing a submodule binds it as an attribute of this module, e.g.,
+    # `scipp.show`, so the requested attribute must be stored explicitly.
+    globals()[name] = value
+    return value
+
+
+def __dir__():
+    return sorted(list(globals()) + list(_LAZY_ATTRIBUTES))
+
+
+def _make_html(container):
+    from .html import make_html
+
+    return make_html(container)
+
+
+setattr(Variable, '_repr_html_', _make_html)
+setattr(DataArray, '_repr_html_', _make_html)
+setattr(Dataset, '_repr_html_', _make_html)
+del _make_html
 
 from .io.hdf5 import save_hdf5 as _save_hdf5
 
@@ -133,7 +168,22 @@ from .core import (
     stddevs,
     where,
 )
-from .core import mean, nanmean, sum, nansum, min, max, nanmin, nanmax, all, any
+from .core import (
+    mean,
+    nanmean,
+    median,
+    nanmedian,
+    quantile,
+    nanquantile,
+    sum,
+    nansum,
+    min,
+    max,
+    nanmin,
+    nanmax,
+    all,
+    any,
+)
 from .core import broadcast, concat, fold, flatten, squeeze, transpose
 from .core import sin, cos, tan, asin, acos, atan, atan2
 from .core import isnan, isinf, isfinite, isposinf, isneginf, to_unit
@@ -183,6 +233,10 @@ for _cls in (Variable, DataArray, Dataset):
             'nansum',
             'mean',
             'nanmean',
+            'median',
+            'nanmedian',
+            'quantile',
+            'nanquantile',
             'max',
             'min',
             'nanmax',
@@ -225,16 +279,22 @@ _binding.bind_functions_as_methods(
 _binding.bind_functions_as_methods(Dataset, globals(), ('hist', 'rebin'))
 del _binding
 
-from . import data
 from . import spatial
 from .operations import elemwise_func
 
 from .core.binning import histogram
 
-from .plotting import plot
 
-setattr(Variable, 'plot', plot)
-setattr(DataArray, 'plot', plot)
-setattr(Dataset, 'plot', plot)
+
+def _plot(*args, **kwargs):
+    from .plotting import plot
+
+    return plot(*args, **kwargs)
+
+
+setattr(Variable, 'plot', _plot)
+setattr(DataArray, 'plot', _plot)
+setattr(Dataset, 'plot', _plot)
+del _plot
 
 from .core.util import VisibleDeprecationWarning
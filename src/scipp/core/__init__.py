@@ -137,7 +137,22 @@ from .operations import (
     to,
     merge,
 )
-from .reduction import mean, nanmean, sum, nansum, min, max, nanmin, nanmax, all, any
+from .reduction import (
+    mean,
+    nanmean,
+    median,
+    nanmedian,
+    quantile,
+    nanquantile,
+    sum,
+    nansum,
+    min,
+    max,
+    nanmin,
+    nanmax,
+    all,
+    any,
+)
 from .shape import broadcast, concat, fold, flatten, squeeze, transpose
 from .trigonometry import sin, cos, tan, asin, acos, atan, atan2
 from .unary import isnan, isinf, isfinite, isposinf, isneginf, to_unit
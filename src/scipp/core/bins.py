@@ -147,6 +147,10 @@ class Bins:
         This is similar to regular label-based indexing, but considers the event-coords,
         i.e., the coord values of individual bin entries. Unlike normal label-based
         indexing this returns a copy, as a subset of events is extracted.
+
+        As an exception, if the events in all bins are sorted by the event-coord,
+        a label range is located in each bin using a binary search and the result
+        is a view that shares the events with the original.
         """
         dim, index = key
         if isinstance(index, _cpp.Variable):
@@ -181,6 +185,8 @@ class Bins:
                 elif index.stop is None:
                     stop = start
 
+            if (view := self._slice_sorted(dim, start, stop)) is not None:
+                return view
             return self._obj.bin({dim: concat([start, stop], dim)}).squeeze(dim)
         raise ValueError(
             f"Unsupported key '{key}'. Expected a dimension label and "
@@ -188,6 +194,36 @@ class Bins:
             "and stop given by a 0-D variable."
         )
 
+    def _slice_sorted(
+        self, dim: str, start: _cpp.Variable, stop: _cpp.Variable
+    ) -> Optional[_cpp.DataArray]:
+        """Equivalent of binning into [start, stop) and squeezing, for sorted bins.
+
+        Returns None if the bins are not sorted by the event-coord ``dim`` or if
+        binning would do more than selecting events.
+        """
+        obj = self._obj
+        if not isinstance(obj, _cpp.DataArray) or dim in obj.dims or dim in obj.meta:
+            return None
+        buffer = self.constituents['data']
+        if not isinstance(buffer, _cpp.DataArray) or dim not in buffer.coords:
+            return None
+        coord = buffer.coords[dim]
+        if any(
+            x.dtype != coord.dtype or x.unit != coord.unit or x.variances is not None
+            for x in (start, stop)
+        ):
+            return None
+        if start > stop:
+            return None
+        if not _cpp.buckets.is_sorted_by(obj.data, dim):
+            return None
+        out = obj.copy(deep=False)
+        out.data = _cpp.buckets.slice_sorted(obj.data, dim, start, stop)
+        out.coords[dim] = concat([start, stop], dim)
+        out.coords.set_aligned(dim, False)
+        return out
+
     @property
     def coords(self) -> MetaDataMap:
         """Coords of the bins"""
@@ -298,6 +334,80 @@ class Bins:
         """
         return _call_cpp_func(_cpp.bins_nanmean, self._obj)
 
+    def median(self) -> Union[_cpp.Variable, _cpp.DataArray]:
+        """Median of events in each bin.
+
+        Masked events are ignored.
+
+        Returns
+        -------
+        :
+            The median of each of the input bins.
+
+        See Also
+        --------
+        scipp.median:
+            For calculating the median of non-bin data.
+        """
+        return _call_cpp_func(_cpp.bins_median, self._obj)
+
+    def nanmedian(self) -> Union[_cpp.Variable, _cpp.DataArray]:
+        """Median of events in each bin ignoring NaN's.
+
+        Returns
+        -------
+        :
+            The median of each of the input bins without NaN's.
+
+        See Also
+        --------
+        scipp.nanmedian:
+            For calculating the median of non-bin data.
+        """
+        return _call_cpp_func(_cpp.bins_nanmedian, self._obj)
+
+    def quantile(self, q: float) -> Union[_cpp.Variable, _cpp.DataArray]:
+        """Quantile of events in each bin.
+
+        Masked events are ignored.
+
+        Parameters
+        ----------
+        q:
+            Quantile to compute, in the range [0, 1].
+
+        Returns
+        -------
+        :
+            The ``q``-quantile of each of the input bins.
+
+        See Also
+        --------
+        scipp.quantile:
+            For calculating quantiles of non-bin data.
+        """
+        return _call_cpp_func(_cpp.bins_quantile, self._obj, q=q)
+
+    def nanquantile(self, q: float) -> Union[_cpp.Variable, _cpp.DataArray]:
+        """Quantile of events in each bin ignoring NaN's.
+
+        Parameters
+        ----------
+        q:
+            Quantile to compute, in the range [0, 1].
+
+        Returns
+        -------
+        :
+            The ``q``-quantile of each of the input bins without NaN's.
+
+        See Also
+        --------
+        scipp.nanquantile:
+            For calculating quantiles of non-bin data.
+        """
+        return _call_cpp_func(_cpp.bins_nanquantile, self._obj, q=q)
+
     def max(self) -> Union[_cpp.Variable, _cpp.DataArray]:
         """Maximum of events in each bin.
 
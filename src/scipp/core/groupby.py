@@ -2,7 +2,7 @@
 # Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 # @author Matthew Andrew
 
-from typing import Optional, Union
+from typing import Optional, Sequence, Union
 
 from .._scipp import core as _cpp
 
@@ -10,7 +10,7 @@ from .._scipp import core as _cpp
 def groupby(
     data: Union[_cpp.DataArray, _cpp.Dataset],
     /,
-    group: Union[_cpp.Variable, str],
+    group: Union[_cpp.Variable, str, Sequence[str]],
     *,
     bins: Optional[_cpp.Variable] = None,
 ) -> Union[_cpp.GroupByDataArray, _cpp.GroupByDataset]:
@@ -21,7 +21,10 @@ def groupby(
     data:
         Input data to reduce.
     group:
-        Name of labels to use for grouping or Variable to use for grouping
+        Name of labels to use for grouping or Variable to use for grouping.
+        If a list of names is given, the data is grouped by the unique
+        combinations of the values of all labels. The output dimension is
+        then ``'group'``, with one coordinate for each of the labels.
     bins:
         Optional bins for grouping label values.
 
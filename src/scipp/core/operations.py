@@ -3,7 +3,7 @@
 # @author Matthew Andrew
 from __future__ import annotations
 
-from typing import Any, Literal, Optional, TypeVar, Union, overload
+from typing import Any, Literal, Optional, Sequence, TypeVar, Union, overload
 
 from .._scipp import core as _cpp
 from ..typing import VariableLikeType
@@ -105,7 +105,7 @@ def allsorted(
 
 def sort(
     x: VariableLikeType,
-    key: Union[str, Variable],
+    key: Union[str, Variable, Sequence[str], Sequence[Variable]],
     order: Literal['ascending', 'descending'] = 'ascending',
 ) -> VariableLikeType:
     """Sort variable along a dimension by a sort key or dimension label.
@@ -115,12 +115,19 @@ def sort(
     - If ``order`` is 'descending',
       sort such that values are non-increasing according to ``key``.
 
+    The sort is stable, i.e., elements with equal keys keep their relative order.
+
+    If a list of keys is given, the sort is lexicographic, i.e., elements are
+    sorted by the first key and elements with equal first key by the second key,
+    and so on.
+
     Parameters
     ----------
     x: scipp.typing.VariableLike
         Data to be sorted.
     key:
-        Either a 1D variable sort key or a dimension label.
+        Either a 1D variable sort key or a dimension label,
+        or a list of either of these.
     order:
         Sorting order.
 
@@ -83,6 +83,135 @@ def nanmean(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
         return _call_cpp_func(_cpp.nanmean, x, dim=dim)
 
 
+
+def median(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+    """Median of elements in the input.
+
+    If the input has masks, masked elements are ignored.
+    For an even number of elements the median is the mean of the two middle
+    elements.
+    Integer input results in an output of dtype float64.
+
+    Parameters
+    ----------
+    x: scipp.typing.VariableLike
+        Input data without variances.
+    dim:
+        Dimension along which to calculate the median. If not
+        given, the median over all dimensions is calculated.
+
+    Returns
+    -------
+    : Same type as x
+        The median of the input values.
+
+    See Also
+    --------
+    scipp.nanmedian:
+        Ignore NaN's when calculating the median.
+    scipp.quantile:
+        Compute arbitrary quantiles.
+    """
+    if dim is None:
+        return _call_cpp_func(_cpp.median, x)
+    else:
+        return _call_cpp_func(_cpp.median, x, dim=dim)
+
+
+def nanmedian(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+    """Median of elements in the input ignoring NaN's.
+
+    Parameters
+    ----------
+    x: scipp.typing.VariableLike
+        Input data without variances.
+    dim:
+        Dimension along which to calculate the median. If not
+        given, the median over all dimensions is calculated.
+
+    Returns
+    -------
+    : Same type as x
+        The median of the input values which are not NaN.
+
+    See Also
+    --------
+    scipp.median:
+        Compute the median without special handling of NaN.
+    """
+    if dim is None:
+        return _call_cpp_func(_cpp.nanmedian, x)
+    else:
+        return _call_cpp_func(_cpp.nanmedian, x, dim=dim)
+
+
+def quantile(
+    x: VariableLikeType, q: float, dim: Optional[str] = None
+) -> VariableLikeType:
+    """Quantile of elements in the input.
+
+    Linear interpolation between the closest ranks is used, the same as the
+    default method of :py:func:`numpy.quantile`.
+    If the input has masks, masked elements are ignored.
+
+    Parameters
+    ----------
+    x: scipp.typing.VariableLike
+        Input data without variances.
+    q:
+        Quantile to compute, in the range [0, 1].
+    dim:
+        Dimension along which to calculate the quantile. If not
+        given, the quantile over all dimensions is calculated.
+
+    Returns
+    -------
+    : Same type as x
+        The ``q``-quantile of the input values.
+
+    See Also
+    --------
+    scipp.nanquantile:
+        Ignore NaN's when calculating the quantile.
+    scipp.median:
+        Shorthand for ``q=0.5``.
+    """
+    if dim is None:
+        return _call_cpp_func(_cpp.quantile, x, q=q)
+    else:
+        return _call_cpp_func(_cpp.quantile, x, q=q, dim=dim)
+
+
+def nanquantile(
+    x: VariableLikeType, q: float, dim: Optional[str] = None
+) -> VariableLikeType:
+    """Quantile of elements in the input ignoring NaN's.
+
+    Parameters
+    ----------
+    x: scipp.typing.VariableLike
+        Input data without variances.
+    q:
+        Quantile to compute, in the range [0, 1].
+    dim:
+        Dimension along which to calculate the quantile. If not
+        given, the quantile over all dimensions is calculated.
+
+    Returns
+    -------
+    : Same type as x
+        The ``q``-quantile of the input values which are not NaN.
+
+    See Also
+    --------
+    scipp.quantile:
+        Compute the quantile without special handling of NaN.
+    """
+    if dim is None:
+        return _call_cpp_func(_cpp.nanquantile, x, q=q)
+    else:
+        return _call_cpp_func(_cpp.nanquantile, x, q=q, dim=dim)
+
 def sum(x: VariableLikeType, dim: Dims = None) -> VariableLikeType:
     """Sum of elements in the input.
 
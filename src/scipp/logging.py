@@ -15,8 +15,6 @@ from dataclasses import dataclass
 from typing import Any, Dict, Optional, Tuple
 
 from .core import DataArray, Dataset, Variable
-from .html import make_html
-from .html.resources import load_style
 from .utils import running_in_jupyter
 
 
@@ -124,6 +122,8 @@ def display_logs() -> None:
     from IPython.display import display
     from ipywidgets import HTML, VBox
 
+    from .html.resources import load_style
+
     display(VBox([HTML(value=load_style()), widget]).add_class('sc-log-wrap'))
 
 
@@ -143,6 +143,8 @@ def _has_html_repr(x: Any) -> bool:
 
 
 def _make_html(x) -> str:
+    from .html import make_html
+
     return f'<div class="sc-log-html-payload">{make_html(x)}</div>'
 
 
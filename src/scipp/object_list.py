@@ -2,12 +2,13 @@
 # Copyright (c) 2023 Scipp contributors (https://github.com/scipp)
 # @file
 # @author Simon Heybrock
-from .html import make_html
 
 
 def _repr_html_():
     import inspect
 
+    from .html import make_html
+
     # Is there a better way to get the scope? The `7` is hard-coded for the
     # current IPython stack when calling _repr_html_ so this is bound to break.
     scope = inspect.stack()[7][0].f_globals
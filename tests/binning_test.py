@@ -126,6 +126,22 @@ def test_hist_binned_custom_edges():
     assert sc.identical(histogrammed.coords['y'], y)
 
 
+def test_hist_table_custom_edges_in_different_unit():
+    da = sc.data.table_xyz(100)
+    y = sc.linspace('y', 200.0, 600.0, num=3, unit='mm')
+    converted = da.copy()
+    converted.coords['y'] = converted.coords['y'].to(unit='mm')
+    assert sc.identical(da.hist(y=y), converted.hist(y=y))
+
+
+def test_hist_binned_custom_edges_in_different_unit():
+    da = sc.data.binned_x(100, 10)
+    y = sc.linspace('y', 200.0, 600.0, num=3, unit='mm')
+    converted = da.copy()
+    converted.bins.coords['y'] = converted.bins.coords['y'].to(unit='mm')
+    assert sc.identical(da.hist(y=y), converted.hist(y=y))
+
+
 def test_hist_x_and_edges_arg_are_position_only_and_are_ok_as_keyword_args():
     da = sc.data.table_xyz(100)
     da.coords['edges'] = da.coords['x']
@@ -6,3 +6,32 @@ import scipp as sc
 
 def test_version():
     assert len(sc.__version__) > 0
+
+
+def test_lazy_attributes_are_available():
+    assert callable(sc.show)
+    assert callable(sc.make_svg)
+    assert callable(sc.to_html)
+    assert callable(sc.make_html)
+    assert callable(sc.table)
+    assert callable(sc.plot)
+    assert callable(sc.data.table_xyz)
+
+
+def test_lazy_attributes_are_listed_by_dir():
+    assert {'show', 'make_html', 'plot', 'data'} <= set(dir(sc))
+
+
+def test_import_does_not_import_visualization_modules():
+    import subprocess
+    import sys
+
+    code = (
+        'import sys, scipp; '
+        'print(any(m in sys.modules for m in '
+        '("scipp.html", "scipp.plotting", "scipp.show", "scipp.data")))'
+    )
+    out = subprocess.run(
+        [sys.executable, '-c', code], capture_output=True, text=True, check=True
+    )
+    assert out.stdout.strip() == 'False'
@@ -134,3 +134,39 @@ def test_bins_slicing_open_stop_too_big_stop_given():
     right = da.bins['x', too_big_start:]
     assert right.bins.size().sum().value == 0
     assert sc.identical(right.meta['x'], sc.concat([too_big_start, too_big_start], 'x'))
+
+
+def make_sorted_by_time(nrow: int = 1000) -> sc.DataArray:
+    table = sc.data.table_xyz(nrow)
+    table.coords['time'] = sc.arange('row', nrow, unit='s')
+    return table.bin(x=10)
+
+
+def test_slice_bins_sorted_by_label_matches_binning():
+    da = make_sorted_by_time()
+    start = sc.scalar(100, unit='s')
+    stop = sc.scalar(700, unit='s')
+    result = da.bins['time', start:stop]
+    assert result.bins.size().sum().value == 600
+    assert not result.coords['time'].aligned
+    assert sc.identical(result, da.bin(time=sc.concat([start, stop], 'time')).squeeze())
+
+
+def test_slice_bins_sorted_by_label_returns_view():
+    da = make_sorted_by_time()
+    before = da.bins.sum().data
+    result = da.bins['time', sc.scalar(100, unit='s') : sc.scalar(700, unit='s')]
+    selected = result.bins.sum().data
+    result.bins.data *= 2.0
+    assert sc.allclose(da.bins.sum().data, before + selected)
+
+
+def test_slice_bins_not_sorted_by_label_matches_binning():
+    da = make_sorted_by_time()
+    da.bins.coords['time'] = -da.bins.coords['time']
+    start = sc.scalar(-700, unit='s')
+    stop = sc.scalar(-100, unit='s')
+    result = da.bins['time', start:stop]
+    assert result.bins.size().sum().value == 600
+    assert sc.identical(result, da.bin(time=sc.concat([start, stop], 'time')).squeeze())
+